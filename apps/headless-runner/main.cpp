@@ -0,0 +1,138 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2024, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <genesis/core/log.h>
+#include <genesis/scene/headless_runner.h>
+
+#include <docopt.h>
+
+#include <iostream>
+#include <map>
+#include <optional>
+#include <string>
+#include <thread>
+
+namespace {
+
+constexpr auto USAGE = R"(Headless Runner
+
+Usage:
+    headless_runner <scene-file> [-n <count>] [-t <ticks>] [-j <threads>]
+    headless_runner (-h | --help)
+
+Options:
+    -h, --help             Show this help.
+    -n, --instances <num>  The number of scene instances to run [default: 1].
+    -t, --ticks <num>      The number of ticks to simulate [default: 600].
+    -j, --jobs <num>       The number of threads running instances, all cores if 0 [default: 0].
+)";
+
+struct args_t {
+    bool        show_help{false};
+    std::string scene_file;
+    uint32_t    instances{1};
+    uint32_t    ticks{600};
+    uint32_t    jobs{0};
+};
+
+std::optional<args_t> parseArgs(int argc, char** argv)
+{
+    std::map<std::string, docopt::value> parsed_args;
+    args_t                               args{};
+
+    try {
+        parsed_args = docopt::docopt_parse(USAGE, {argv + 1, argv + argc}, true, false);
+        args.scene_file = parsed_args["<scene-file>"].asString();
+        args.instances = static_cast<uint32_t>(parsed_args["--instances"].asLong());
+        args.ticks = static_cast<uint32_t>(parsed_args["--ticks"].asLong());
+        args.jobs = static_cast<uint32_t>(parsed_args["--jobs"].asLong());
+    } catch (const docopt::DocoptExitHelp& e) {
+        args.show_help = true;
+    } catch (const std::exception& e) {
+        std::cerr << "Failed to parse arguments: '" << e.what() << "'\n";
+        return {};
+    }
+
+    return args;
+}
+
+void printReport(uint32_t instance, const GE::Scene::HeadlessRunner::report_t& report)
+{
+    if (!report.is_loaded) {
+        std::cout << "instance " << instance << ": failed to load the scene\n";
+        return;
+    }
+
+    std::cout << "instance " << instance << ": ticks " << report.tick_count << ", hash 0x"
+              << std::hex << report.state_hash << std::dec << ", load "
+              << report.load_time.ms() << " ms, simulation " << report.simulation_time.ms()
+              << " ms, max tick " << report.max_tick_time.ms() << " ms\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    auto args = parseArgs(argc, argv);
+
+    if (!args.has_value()) {
+        std::cerr << USAGE;
+        return EXIT_FAILURE;
+    }
+
+    if (args->show_help) {
+        std::cout << USAGE;
+        return EXIT_SUCCESS;
+    }
+
+    if (!GE::Log::initialize({})) {
+        return EXIT_FAILURE;
+    }
+
+    GE::Scene::HeadlessRunner::config_t config;
+    config.scene_filepath = args->scene_file;
+    config.tick_count = args->ticks;
+
+    uint32_t jobs = args->jobs != 0 ? args->jobs : std::thread::hardware_concurrency();
+    std::vector<GE::Scene::HeadlessRunner::config_t> configs(args->instances, config);
+    auto reports = GE::Scene::HeadlessRunner::runParallel(configs, jobs);
+
+    bool is_succeeded{true};
+
+    for (uint32_t i{0}; i < reports.size(); i++) {
+        printReport(i, reports[i]);
+        is_succeeded = is_succeeded && reports[i].is_loaded;
+    }
+
+    GE::Log::shutdown();
+    return is_succeeded ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -133,6 +133,7 @@ void AssetsPanel::drawPackage(WidgetNode* node, const Package& package)
         drawResources<MeshResource>(&package_node, package);
         drawResources<PipelineResource>(&package_node, package);
         drawResources<TextureResource>(&package_node, package);
+        drawResources<PrefabResource>(&package_node, package);
     }
 }
 
@@ -191,6 +192,17 @@ void AssetsPanel::drawResource(WidgetNode* node, const GE::Shared<TextureResourc
     }
 }
 
+void AssetsPanel::drawResource(WidgetNode* node, const GE::Shared<PrefabResource>& resource)
+{
+    auto prefab_node = node->makeSubNode<TreeNode>(resource->id().name(), TREE_NODE_FLAGS);
+    prefab_node.call<Text>("Filepath: %s", resource->filepath().c_str());
+
+    if (auto popup_context = WidgetNode::create<PopupContextItem>();
+        popup_context.call<MenuItem>(GE_FMTSTR("Remove '{}'", resource->id().asString()))) {
+        m_commands.removeResource(resource->id());
+    }
+}
+
 template<typename T>
 void AssetsPanel::drawResources(WidgetNode* node, const Package& package)
 {
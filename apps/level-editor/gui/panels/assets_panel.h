@@ -94,6 +94,8 @@ private:
                       const GE::Shared<GE::Assets::PipelineResource>& resource);
     void drawResource(GE::GUI::WidgetNode*                           node,
                       const GE::Shared<GE::Assets::TextureResource>& resource);
+    void drawResource(GE::GUI::WidgetNode*                          node,
+                      const GE::Shared<GE::Assets::PrefabResource>& resource);
 
     template<typename T>
     void drawResources(GE::GUI::WidgetNode* node, const GE::Assets::Package& package);
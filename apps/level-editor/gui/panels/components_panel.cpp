@@ -47,7 +47,7 @@ namespace LE {
 namespace {
 
 template<typename T>
-const char* isLoaded(const GE::Shared<T>& resource)
+const char* isLoaded(const T& resource)
 {
     return resource != nullptr ? "loaded" : "null";
 }
@@ -143,28 +143,49 @@ void ComponentsPanel::draw(WidgetNode* node, MaterialComponent* material)
 
 void ComponentsPanel::draw(WidgetNode* node, TagComponent* tag)
 {
-    node->call<InputText>("Tag", &tag->tag);
+    // The tag is patched to keep the scene name index up to date
+    if (auto tag_text = tag->tag(); node->call<InputText>("Tag", &tag_text)) {
+        m_ctx->selectedEntity()->patch<TagComponent>(
+            [&tag_text](auto& component) { component.setTag(tag_text); });
+    }
 }
 
 void ComponentsPanel::draw(WidgetNode* node, TransformComponent* transform)
 {
-    node->call<ValueEditor>("Translation", &transform->translation, 0.05f, -10.0f, 10.0f);
+    bool is_changed = node->call<ValueEditor>("Translation", &transform->translation, 0.05f,
+                                              -10.0f, 10.0f);
     if (auto angles = GE::degrees(transform->rotation);
         node->call<ValueEditor>("Rotation", &angles, 1.0f, -360.0f, 360.0f)) {
         transform->rotation = GE::radians(angles);
+        is_changed = true;
+    }
+    is_changed |= node->call<ValueEditor>("Scale", &transform->scale, 0.1, 0.0f, 10.0f);
+
+    // The transform is patched to keep the scene spatial index up to date
+    if (is_changed) {
+        m_ctx->selectedEntity()->patch<TransformComponent>();
     }
-    node->call<ValueEditor>("Scale", &transform->scale, 0.1, 0.0f, 10.0f);
 }
 
-void ComponentsPanel::draw(WidgetNode* node, SpriteComponent* sprite)
+void ComponentsPanel::draw(WidgetNode* node, SpriteResourcesComponent* resources)
 {
-    auto mesh_id = sprite->meshID().asString();
-    auto texture_id = sprite->textureID().asString();
+    auto mesh_id = resources->mesh.asString();
+    auto texture_id = resources->texture.asString();
 
-    node->call<Text>("Mesh: %s (%s)", mesh_id.data(), isLoaded(sprite->mesh));
-    node->call<Text>("Texture: %s (%s)", texture_id.data(), isLoaded(sprite->texture));
-    if (node->call<Button>("Load")) {
-        sprite->loadAll(m_ctx->assets());
+    node->call<Text>("Mesh: %s", mesh_id.data());
+    node->call<Text>("Texture: %s", texture_id.data());
+}
+
+void ComponentsPanel::draw(WidgetNode* node, SpriteComponent* sprite)
+{
+    const auto* assets = m_ctx->assets();
+    auto*       entity = m_ctx->selectedEntity();
+
+    node->call<Text>("Mesh: %s", isLoaded(assets->resolve(sprite->mesh)));
+    node->call<Text>("Texture: %s", isLoaded(assets->resolve(sprite->texture)));
+    if (entity->has<SpriteResourcesComponent>() && node->call<Button>("Load")) {
+        entity->get<SpriteResourcesComponent>().loadAll(sprite, m_ctx->assets());
+        entity->patch<SpriteComponent>();
     }
 }
 
@@ -192,6 +213,8 @@ void ComponentsPanel::draw(WidgetNode* node, body_shape_config_base_t* shape_con
     node->call<ValueEditor>("Friction", &shape_config->friction, 0.1f, 0.0f, 10.0f);
     node->call<ValueEditor>("Restitution", &shape_config->restitution, 0.1f, 0.0f, 10.0f);
     node->call<ValueEditor>("Density", &shape_config->density, 0.1f, 0.0f, 10.0f);
+    node->call<Checkbox>("Sensor", &shape_config->is_sensor);
+    node->call<Checkbox>("Hit events", &shape_config->enable_hit_events);
 }
 
 void ComponentsPanel::draw(WidgetNode* node, BoxCollider2DComponent* collider)
@@ -50,6 +50,7 @@ struct MaterialComponent;
 struct CircleCollider2DComponent;
 struct RigidBody2DComponent;
 struct SpriteComponent;
+struct SpriteResourcesComponent;
 struct TagComponent;
 struct TransformComponent;
 } // namespace GE::Scene
@@ -77,6 +78,7 @@ private:
     void draw(GE::GUI::WidgetNode* node, GE::Scene::MaterialComponent* material);
     void draw(GE::GUI::WidgetNode* node, GE::Scene::TagComponent* tag);
     void draw(GE::GUI::WidgetNode* node, GE::Scene::TransformComponent* transform);
+    void draw(GE::GUI::WidgetNode* node, GE::Scene::SpriteResourcesComponent* resources);
     void draw(GE::GUI::WidgetNode* node, GE::Scene::SpriteComponent* sprite);
     void draw(GE::GUI::WidgetNode* node, GE::Scene::RigidBody2DComponent* rigid_body);
     void draw(GE::GUI::WidgetNode* node, GE::P2D::body_shape_config_base_t* shape_config);
@@ -47,6 +47,11 @@ void DeferredScenePanelCommands::selectEntity(const Entity& entity)
     enqueue([this, entity] { *m_ctx->selectedEntity() = entity; });
 }
 
+void DeferredScenePanelCommands::duplicateEntity(const Entity& entity)
+{
+    enqueue([this, entity] { *m_ctx->selectedEntity() = m_ctx->scene()->duplicateEntity(entity); });
+}
+
 void DeferredScenePanelCommands::removeEntity(const Entity& entity)
 {
     enqueue([this, entity] {
@@ -91,7 +96,11 @@ void ScenePanel::onRender()
 
 void ScenePanel::drawScene(WidgetNode* node)
 {
-    if (auto head_entity = m_ctx->scene()->headEntity(); !head_entity.isNull()) {
+    node->call<InputText>("Search", &m_search_pattern);
+
+    if (!m_search_pattern.empty()) {
+        drawSearchResults(node);
+    } else if (auto head_entity = m_ctx->scene()->headEntity(); !head_entity.isNull()) {
         drawEntities(node, EntityNode{head_entity});
     }
 
@@ -103,6 +112,15 @@ void ScenePanel::drawScene(WidgetNode* node)
     m_is_select_entity_handled = false;
 }
 
+void ScenePanel::drawSearchResults(WidgetNode* node)
+{
+    const auto* scene = m_ctx->scene();
+
+    scene->nameIndex().search(m_search_pattern, [this, node, scene](auto entity_handle) {
+        drawEntity(node, scene->entity(entity_handle));
+    });
+}
+
 // NOLINTNEXTLINE(misc-no-recursion)
 void ScenePanel::drawEntities(WidgetNode* node, const EntityNode& entity)
 {
@@ -126,12 +144,16 @@ void ScenePanel::drawEntity(WidgetNode* node, const Entity& entity)
         flags |= TreeNode::LEAF;
     }
 
-    std::string_view tag = entity.get<TagComponent>().tag;
+    std::string_view tag = entity.get<TagComponent>().tag();
     auto             entity_tree_node = node->makeSubNode<TreeNode>(tag, flags);
 
-    if (auto popup_context = WidgetNode::create<PopupContextItem>();
-        popup_context.call<MenuItem>(GE_FMTSTR("Remove '{}'", tag))) {
-        m_commands.removeEntity(entity);
+    if (auto popup_context = WidgetNode::create<PopupContextItem>(); popup_context.isOpened()) {
+        if (popup_context.call<MenuItem>(GE_FMTSTR("Duplicate '{}'", tag))) {
+            m_commands.duplicateEntity(entity);
+        }
+        if (popup_context.call<MenuItem>(GE_FMTSTR("Remove '{}'", tag))) {
+            m_commands.removeEntity(entity);
+        }
     }
 
     if (!m_is_select_entity_handled && isItemClicked()) {
@@ -156,7 +178,7 @@ void ScenePanel::drawEntityDragDrop(const Entity& entity)
     const auto& tag = entity.get<TagComponent>();
 
     DragDropPayload drag_drop_paylaod{PAYLOAD_TYPE.data(), &entity_handle};
-    WidgetNode::create<DragDropSource>(drag_drop_paylaod, tag.tag);
+    WidgetNode::create<DragDropSource>(drag_drop_paylaod, tag.tag());
     WidgetNode::create<DragDropTarget>(&drag_drop_paylaod);
 
     if (drag_drop_paylaod.accepted()) {
@@ -171,7 +193,7 @@ void ScenePanel::drawEntityDragDrop(const Entity& entity)
         return;
     }
 
-    auto dst_tag = entity.get<TagComponent>().tag;
+    auto dst_tag = entity.get<TagComponent>().tag();
     auto drop_entity_popup = WidgetNode::create<PopupContextItem>(POPUP_ID);
 
     if (drop_entity_popup.call<MenuItem>(GE_FMTSTR("Append to '{}'", dst_tag))) {
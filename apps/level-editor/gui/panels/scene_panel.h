@@ -36,6 +36,8 @@
 #include <genesis/gui/window/window_base.h>
 #include <genesis/scene/entity.h>
 
+#include <string>
+
 namespace GE::GUI {
 class WidgetNode;
 } // namespace GE::GUI
@@ -56,6 +58,7 @@ public:
     {}
 
     void selectEntity(const GE::Scene::Entity& entity);
+    void duplicateEntity(const GE::Scene::Entity& entity);
     void removeEntity(const GE::Scene::Entity& entity);
     void appendEntity(const GE::Scene::Entity& dst, const GE::Scene::Entity& src);
     void appendToChildren(const GE::Scene::Entity& dst, const GE::Scene::Entity& src);
@@ -77,6 +80,7 @@ public:
 
 private:
     void drawScene(GE::GUI::WidgetNode* node);
+    void drawSearchResults(GE::GUI::WidgetNode* node);
 
     void drawEntities(GE::GUI::WidgetNode* node, const GE::Scene::EntityNode& entity);
     void drawEntity(GE::GUI::WidgetNode* node, const GE::Scene::Entity& entity);
@@ -88,6 +92,7 @@ private:
     LevelEditorContext*        m_ctx{nullptr};
     DeferredScenePanelCommands m_commands;
 
+    std::string       m_search_pattern;
     bool              m_is_select_entity_handled{false};
     GE::Scene::Entity m_drag_drop_src_entity;
     GE::Scene::Entity m_drag_drop_dst_entity;
@@ -108,7 +108,7 @@ void ViewportPanel::drawGizmos(GE::Scene::Entity* entity)
     const auto& view = camera->view();
     const auto& projection = camera->projection();
 
-    auto& tc = entity->get<GE::Scene::TransformComponent>();
+    const auto& tc = entity->get<GE::Scene::TransformComponent>();
     auto  parent_transform = GE::Scene::parentTransform(*entity);
     auto  transform_matrix = parent_transform * tc.transform();
     bool  is_ortho = camera->type() == GE::Scene::ProjectionCamera::ORTHOGRAPHIC;
@@ -119,15 +119,21 @@ void ViewportPanel::drawGizmos(GE::Scene::Entity* entity)
 
     if (gizmos.isUsing()) {
         auto local_transfrom = GE::inverse(parent_transform) * transform_matrix;
-        decompose(local_transfrom, &tc.translation, &tc.rotation, &tc.scale);
-        tc.rotation = GE::radians(tc.rotation);
+        entity->patch<GE::Scene::TransformComponent>([&local_transfrom](auto& transform) {
+            decompose(local_transfrom, &transform.translation, &transform.rotation,
+                      &transform.scale);
+            transform.rotation = GE::radians(transform.rotation);
+        });
     }
 }
 
 bool ViewportPanel::onMouseButtonReleased(const GE::MouseButtonReleasedEvent& event)
 {
     if (isPanelActive() && event.getMouseButton() == GE::MouseButton::LEFT) {
-        *m_ctx->selectedEntity() = m_ctx->entityPicker()->getEntityByPosition(m_mouse_position);
+        m_ctx->entityPicker()->pickEntity(m_mouse_position,
+                                          [ctx = m_ctx](const GE::Scene::Entity& entity) {
+                                              *ctx->selectedEntity() = entity;
+                                          });
     }
 
     return false;
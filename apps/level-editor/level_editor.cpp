@@ -44,6 +44,9 @@
 #include "genesis/physics2d.h"
 #include "genesis/scene.h"
 
+#include <algorithm>
+#include <thread>
+
 using namespace GE::GUI;
 
 namespace LE {
@@ -53,6 +56,15 @@ const auto SETTINGS_FILE =
     GE::FS::joinPath(GE::FS::cacheDir(LEVEL_EDITOR_APP_NAME), "settings.yaml");
 
 constexpr GE::Vec2 GRAVITY{0.0f, -9.8f};
+constexpr uint32_t MAX_PHYSICS_WORKERS{4};
+// Scene loading shares a frame with the editor, so it only gets a slice of it
+constexpr GE::Timestamp SCENE_LOADING_BUDGET{GE::Timestamp::Milli{4.0}};
+
+GE::P2D::thread_config_t physicsThreadConfig()
+{
+    auto worker_count = std::clamp(std::thread::hardware_concurrency(), 1U, MAX_PHYSICS_WORKERS);
+    return {.worker_count = worker_count};
+}
 
 } // namespace
 
@@ -73,7 +85,7 @@ bool LevelEditor::initialize()
         return false;
     }
 
-    m_ctx.world() = GE::P2D::World::create(GRAVITY);
+    m_ctx.world() = GE::P2D::World::create(GRAVITY, physicsThreadConfig());
     m_gui = GE::makeScoped<LevelEditorGUI>(&m_ctx);
     connectSignals();
     createSceneRenderer();
@@ -88,7 +100,9 @@ void LevelEditor::shutdown()
 
 void LevelEditor::onUpdate(GE::Timestamp ts)
 {
+    updateSceneLoading();
     m_ctx.sceneExecutor()->onUpdate(ts);
+    m_ctx.entityPicker()->poll();
     m_gui->onUpdate(ts);
 }
 
@@ -101,8 +115,8 @@ void LevelEditor::onRender()
 {
     updateParameters();
 
+    m_ctx.scene()->updateSpatialIndex(*m_ctx.assets());
     m_ctx.sceneRenderer()->render(*m_ctx.scene());
-    m_ctx.entityPicker()->onRender();
     m_gui->onRender();
 }
 
@@ -171,7 +185,25 @@ void LevelEditor::updateParameters()
     if (m_ctx.sceneFbo()->size() != m_viewport) {
         m_ctx.sceneFbo()->resize(m_viewport);
         m_ctx.cameraController()->camera()->setViewport(m_viewport);
-        m_ctx.entityPicker()->onViewportUpdate(m_viewport);
+    }
+}
+
+void LevelEditor::updateSceneLoading()
+{
+    if (m_scene_loader == nullptr) {
+        return;
+    }
+
+    using Status = GE::Scene::SceneDeserializer::Status;
+
+    auto status = m_scene_loader->update(SCENE_LOADING_BUDGET);
+
+    if (status == Status::DONE) {
+        m_ctx.settings()->currentProject()->setScenePath(m_scene_loader->filepath());
+    }
+
+    if (status == Status::DONE || status == Status::FAILED) {
+        m_scene_loader.reset();
     }
 }
 
@@ -220,12 +252,10 @@ bool LevelEditor::saveAssets(std::string_view filepath)
     return true;
 }
 
-bool LevelEditor::loadScene(std::string_view filepath)
+void LevelEditor::loadScene(std::string_view filepath)
 {
-    GE::Scene::SceneDeserializer deserializer{m_ctx.scene(), m_ctx.assets()};
-    deserializer.deserialize(filepath.data());
-    m_ctx.settings()->currentProject()->setScenePath(filepath.data());
-    return true;
+    m_scene_loader = GE::makeScoped<GE::Scene::SceneDeserializer>(m_ctx.scene(), m_ctx.assets());
+    m_scene_loader->start(std::string{filepath});
 }
 
 bool LevelEditor::saveScene(std::string_view filepath)
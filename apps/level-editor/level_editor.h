@@ -44,6 +44,10 @@ namespace GE {
 class Event;
 } // namespace GE
 
+namespace GE::Scene {
+class SceneDeserializer;
+} // namespace GE::Scene
+
 namespace LE {
 
 class LevelEditorGUI;
@@ -69,12 +73,14 @@ private:
     void initializeProject();
 
     void updateParameters();
+    void updateSceneLoading();
 
     void loadSettings();
     bool saveSettings();
     bool loadAssets(std::string_view filepath);
     bool saveAssets(std::string_view filepath);
-    bool loadScene(std::string_view filepath);
+    // The scene is loaded over the next frames, the project refers to it once it is loaded
+    void loadScene(std::string_view filepath);
     bool saveScene(std::string_view filepath);
     bool loadProject(std::string_view filepath);
     bool saveProject(std::string_view filepath);
@@ -86,8 +92,9 @@ private:
     void onLoadProject();
     void onSaveProject();
 
-    LevelEditorContext         m_ctx;
-    GE::Scoped<LevelEditorGUI> m_gui;
+    LevelEditorContext                       m_ctx;
+    GE::Scoped<LevelEditorGUI>               m_gui;
+    GE::Scoped<GE::Scene::SceneDeserializer> m_scene_loader;
 
     GE::Vec2 m_viewport{1.0f, 1.0f};
 };
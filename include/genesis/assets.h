@@ -36,6 +36,7 @@
 #include <genesis/assets/iresource.h>
 #include <genesis/assets/mesh_resource.h>
 #include <genesis/assets/pipeline_resource.h>
+#include <genesis/assets/prefab_resource.h>
 #include <genesis/assets/registry.h>
 #include <genesis/assets/resource_base.h>
 #include <genesis/assets/resource_deserializer.h>
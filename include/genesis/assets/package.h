@@ -34,12 +34,14 @@
 
 #include <genesis/assets/mesh_resource.h>
 #include <genesis/assets/pipeline_resource.h>
+#include <genesis/assets/prefab_resource.h>
 #include <genesis/assets/resource_id.h>
 #include <genesis/assets/texture_resource.h>
 #include <genesis/core/export.h>
 #include <genesis/core/memory.h>
 
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace GE::Assets {
@@ -79,24 +81,33 @@ private:
     std::string m_name;
     std::string m_filepath;
 
-    std::unordered_map<std::string, Shared<PipelineResource>> m_pipelines;
-    std::unordered_map<std::string, Shared<MeshResource>>     m_meshes;
-    std::unordered_map<std::string, Shared<TextureResource>>  m_textures;
+    template<typename T>
+    using ResourceMap = std::unordered_map<ResourceID, Shared<T>>;
+
+    template<typename T>
+    static Shared<T> find(const ResourceMap<T>& resources, const ResourceID& id);
+
+    ResourceMap<PipelineResource> m_pipelines;
+    ResourceMap<MeshResource>     m_meshes;
+    ResourceMap<TextureResource>  m_textures;
+    ResourceMap<PrefabResource>   m_prefabs;
 };
 
 template<typename T>
 Shared<T> Package::get(const ResourceID& id) const
 {
-    if (m_name != id.package() || T::GROUP != id.group()) {
+    if (T::GROUP != id.group()) {
         return nullptr;
     }
 
     if constexpr (T::GROUP == Group::PIPELINES) {
-        return m_pipelines.contains(id.name()) ? m_pipelines.at(id.name()) : nullptr;
+        return find(m_pipelines, id);
     } else if constexpr (T::GROUP == Group::MESHES) {
-        return m_meshes.contains(id.name()) ? m_meshes.at(id.name()) : nullptr;
+        return find(m_meshes, id);
     } else if constexpr (T::GROUP == Group::TEXTURES) {
-        return m_textures.contains(id.name()) ? m_textures.at(id.name()) : nullptr;
+        return find(m_textures, id);
+    } else if constexpr (T::GROUP == Group::PREFABS) {
+        return find(m_prefabs, id);
     } else {
         static_assert(!std::is_same_v<T, T>, "Invalid resource group");
     }
@@ -119,6 +130,9 @@ std::vector<Shared<T>> Package::getAllOf() const
     } else if constexpr (T::GROUP == Group::TEXTURES) {
         resources.resize(m_textures.size());
         std::transform(m_textures.cbegin(), m_textures.cend(), resources.begin(), get_value);
+    } else if constexpr (T::GROUP == Group::PREFABS) {
+        resources.resize(m_prefabs.size());
+        std::transform(m_prefabs.cbegin(), m_prefabs.cend(), resources.begin(), get_value);
     } else {
         static_assert(!std::is_same_v<T, T>, "Invalid resource group");
     }
@@ -139,11 +153,13 @@ Shared<T> Package::createResource(const typename T::config_t& config)
     }
 
     if constexpr (T::GROUP == Group::PIPELINES) {
-        return m_pipelines.emplace(config.name, resource).first->second;
+        return m_pipelines.emplace(resource->id(), resource).first->second;
     } else if constexpr (T::GROUP == Group::MESHES) {
-        return m_meshes.emplace(config.name, resource).first->second;
+        return m_meshes.emplace(resource->id(), resource).first->second;
     } else if constexpr (T::GROUP == Group::TEXTURES) {
-        return m_textures.emplace(config.name, resource).first->second;
+        return m_textures.emplace(resource->id(), resource).first->second;
+    } else if constexpr (T::GROUP == Group::PREFABS) {
+        return m_prefabs.emplace(resource->id(), resource).first->second;
     } else {
         static_assert(!std::is_same_v<T, T>, "Invalid resource group");
     }
@@ -151,4 +167,11 @@ Shared<T> Package::createResource(const typename T::config_t& config)
     return nullptr;
 }
 
+template<typename T>
+Shared<T> Package::find(const ResourceMap<T>& resources, const ResourceID& id)
+{
+    auto resource = resources.find(id);
+    return resource != resources.end() ? resource->second : nullptr;
+}
+
 } // namespace GE::Assets
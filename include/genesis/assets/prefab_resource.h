@@ -0,0 +1,76 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2024, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <genesis/assets/resource_base.h>
+#include <genesis/core/memory.h>
+
+#include <yaml-cpp/node/node.h>
+
+#include <string>
+
+namespace GE::Assets {
+
+class Package;
+
+// A prefab is described by a scene file, so any saved scene can be used as a prefab. The
+// resource keeps only the parsed description, baking it into component arrays is up to the scene.
+class GE_API PrefabResource: public ResourceBase
+{
+public:
+    class Factory;
+
+    struct config_t {
+        std::string name;
+        std::string filepath;
+    };
+
+    const YAML::Node& description() const { return m_description; }
+    const std::string& filepath() const { return m_filepath; }
+
+    static constexpr Group GROUP{Group::PREFABS};
+
+private:
+    PrefabResource(const std::string& package, const config_t& config);
+
+    std::string m_filepath;
+    YAML::Node  m_description;
+};
+
+class PrefabResource::Factory
+{
+    friend Package;
+    static Shared<PrefabResource> create(const std::string& package, const config_t& config);
+};
+
+} // namespace GE::Assets
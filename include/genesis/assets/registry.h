@@ -34,12 +34,17 @@
 
 #include <genesis/assets/package.h>
 #include <genesis/assets/resource_id.h>
+#include <genesis/core/handle_pool.h>
 #include <genesis/core/memory.h>
 
+#include <span>
 #include <unordered_map>
 
 namespace GE::Assets {
 
+using TextureHandle = Handle<Texture>;
+using MeshHandle = Handle<Mesh>;
+
 class ResourceVisitor;
 class IResource;
 
@@ -73,14 +78,30 @@ public:
     std::vector<const Package*> allPackages() const;
     std::vector<ResourceID> allResourceIDs();
 
+    // Handles are issued once per resource and stay valid until the resource or its package is
+    // removed, after that they resolve to null. The registry keeps the only tracked reference.
+    TextureHandle textureHandle(const ResourceID& id);
+    MeshHandle meshHandle(const ResourceID& id);
+
+    Texture* resolve(TextureHandle handle) const { return m_textures.get(handle); }
+    Mesh* resolve(MeshHandle handle) const { return m_meshes.get(handle); }
+
+    void resolve(std::span<const TextureHandle> handles, std::span<Texture*> textures) const;
+    void resolve(std::span<const MeshHandle> handles, std::span<Mesh*> meshes) const;
+
 private:
-    std::unordered_map<std::string, Package> m_packages;
+    std::unordered_map<StringTable::ID, Package> m_packages;
+
+    HandlePool<Texture>                           m_textures;
+    HandlePool<Mesh>                              m_meshes;
+    std::unordered_map<ResourceID, TextureHandle> m_texture_handles;
+    std::unordered_map<ResourceID, MeshHandle>    m_mesh_handles;
 };
 
 template<typename T>
 Shared<T> Registry::get(const ResourceID& id) const
 {
-    if (auto package = m_packages.find(id.package()); package != m_packages.end()) {
+    if (auto package = m_packages.find(id.packageID()); package != m_packages.end()) {
         return package->second.template get<T>(id);
     }
 
@@ -92,7 +113,7 @@ std::vector<Shared<T>> Registry::getAllOf() const
 {
     std::vector<Shared<T>> all_resources;
 
-    for (const auto& [package_name, package] : m_packages) {
+    for (const auto& [package_id, package] : m_packages) {
         auto resources = package.template getAllOf<T>();
         std::copy(resources.cbegin(), resources.cend(), std::back_inserter(all_resources));
     }
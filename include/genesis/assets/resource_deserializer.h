@@ -55,6 +55,7 @@ private:
     void deserializeMeshes(Package* package, const YAML::Node& package_node);
     void deserializePipelines(Package* package, const YAML::Node& package_node);
     void deserializeTextures(Package* package, const YAML::Node& package_node);
+    void deserializePrefabs(Package* package, const YAML::Node& package_node);
 
     template<typename T>
     void deserializeResource(Package* package, const YAML::Node& resource_node);
@@ -36,9 +36,11 @@
 #include <genesis/core/export.h>
 #include <genesis/core/format.h>
 #include <genesis/core/hash.h>
+#include <genesis/core/string_table.h>
 
 #include <functional>
 #include <string>
+#include <string_view>
 
 namespace GE::Assets {
 
@@ -47,83 +49,53 @@ enum class Group : uint8_t
     UNKNOWN,
     PIPELINES,
     MESHES,
-    TEXTURES
+    TEXTURES,
+    PREFABS
 };
 
+// The package and the name are interned, so an ID is a few integers with a precomputed hash.
+// Their strings are needed only for serialization and display.
 class GE_API ResourceID
 {
 public:
     ResourceID() = default;
-    ResourceID(const ResourceID& other) { copy(other); }
-    ResourceID(ResourceID&& other) noexcept { move(other); }
-    ResourceID(std::string package, Group group, std::string name);
+    ResourceID(std::string_view package, Group group, std::string_view name);
 
-    ~ResourceID() = default;
+    friend bool operator==(const ResourceID& lhs, const ResourceID& rhs);
 
-    ResourceID& operator=(const ResourceID& other);
-    ResourceID& operator=(ResourceID&& other) noexcept;
-    auto operator<=>(const ResourceID& other) const = default;
-
-    const std::string& package() const { return m_package; }
+    const std::string& package() const { return StringTable::string(m_package); }
     Group group() const { return m_group; }
-    const std::string& name() const { return m_name; }
+    const std::string& name() const { return StringTable::string(m_name); }
 
-    std::string* package() { return &m_package; }
-    Group* group() { return &m_group; }
-    std::string* name() { return &m_name; }
+    StringTable::ID packageID() const { return m_package; }
+    StringTable::ID nameID() const { return m_name; }
+    size_t hash() const { return m_hash; }
 
     std::string asString() const;
 
 private:
-    void copy(const ResourceID& other);
-    void move(ResourceID& other);
-
-    std::string m_package;
-    Group       m_group{Group::UNKNOWN};
-    std::string m_name;
+    StringTable::ID m_package{StringTable::EMPTY_ID};
+    StringTable::ID m_name{StringTable::EMPTY_ID};
+    Group           m_group{Group::UNKNOWN};
+    size_t          m_hash{combinedHash(m_package, m_group, m_name)};
 };
 
-inline ResourceID::ResourceID(std::string package, Group group, std::string name)
-    : m_package{std::move(package)}
+inline ResourceID::ResourceID(std::string_view package, Group group, std::string_view name)
+    : m_package{StringTable::intern(package)}
+    , m_name{StringTable::intern(name)}
     , m_group{group}
-    , m_name{std::move(name)}
+    , m_hash{combinedHash(m_package, m_group, m_name)}
 {}
 
-inline ResourceID& ResourceID::operator=(const ResourceID& other)
+inline bool operator==(const ResourceID& lhs, const ResourceID& rhs)
 {
-    if (this != &other) {
-        copy(other);
-    }
-
-    return *this;
-}
-
-inline ResourceID& ResourceID::operator=(ResourceID&& other) noexcept
-{
-    if (this != &other) {
-        move(other);
-    }
-
-    return *this;
+    return lhs.m_package == rhs.m_package && lhs.m_group == rhs.m_group &&
+           lhs.m_name == rhs.m_name;
 }
 
 inline std::string ResourceID::asString() const
 {
-    return GE_FMTSTR("{}.{}.{}", m_package, GE::toString(m_group), m_name);
-}
-
-inline void ResourceID::copy(const ResourceID& other)
-{
-    m_package = other.m_package;
-    m_group = other.m_group;
-    m_name = other.m_name;
-}
-
-inline void ResourceID::move(ResourceID& other)
-{
-    m_package = std::move(other.m_package);
-    m_group = other.m_group;
-    m_name = std::move(other.m_name);
+    return GE_FMTSTR("{}.{}.{}", package(), GE::toString(m_group), name());
 }
 
 } // namespace GE::Assets
@@ -132,6 +104,6 @@ template<>
 struct std::hash<GE::Assets::ResourceID> {
     size_t operator()(const GE::Assets::ResourceID& id) const noexcept
     {
-        return GE::combinedHash(id.package(), id.group(), id.name());
+        return id.hash();
     }
 };
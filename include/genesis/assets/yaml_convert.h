@@ -34,6 +34,7 @@
 
 #include <genesis/assets/mesh_resource.h>
 #include <genesis/assets/pipeline_resource.h>
+#include <genesis/assets/prefab_resource.h>
 #include <genesis/assets/resource_id.h>
 #include <genesis/assets/texture_resource.h>
 
@@ -136,4 +137,25 @@ struct convert<GE::Assets::TextureResource> {
     }
 };
 
+template<>
+struct convert<GE::Assets::PrefabResource::config_t> {
+    static bool decode(const Node& node, GE::Assets::PrefabResource::config_t& config)
+    {
+        config.name = node["name"].as<std::string>();
+        config.filepath = node["filepath"].as<std::string>();
+        return true;
+    }
+};
+
+template<>
+struct convert<GE::Assets::PrefabResource> {
+    static Node encode(const GE::Assets::PrefabResource& resource)
+    {
+        Node node;
+        node["name"] = resource.id().name();
+        node["filepath"] = resource.filepath();
+        return node;
+    }
+};
+
 } // namespace YAML
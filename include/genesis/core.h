@@ -41,9 +41,12 @@
 #include <genesis/core/exception.h>
 #include <genesis/core/export.h>
 #include <genesis/core/format.h>
+#include <genesis/core/handle_pool.h>
 #include <genesis/core/interface.h>
+#include <genesis/core/job_system.h>
 #include <genesis/core/log.h>
 #include <genesis/core/memory.h>
+#include <genesis/core/string_table.h>
 #include <genesis/core/string_utils.h>
 #include <genesis/core/timestamp.h>
 #include <genesis/core/type_list.h>
@@ -0,0 +1,144 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2024, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <genesis/core/asserts.h>
+#include <genesis/core/memory.h>
+
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace GE {
+
+template<typename T>
+struct Handle {
+    uint32_t index{NULL_INDEX};
+    uint32_t generation{0};
+
+    bool isNull() const { return index == NULL_INDEX; }
+
+    friend constexpr bool operator==(const Handle& lhs, const Handle& rhs) = default;
+
+    static constexpr uint32_t NULL_INDEX{std::numeric_limits<uint32_t>::max()};
+};
+
+// Objects are kept in a flat array of slots. A handle stays valid until its slot is released,
+// after that the slot generation changes and the handle resolves to null, even when the slot has
+// been reused.
+template<typename T>
+class HandlePool
+{
+public:
+    Handle<T> insert(Shared<T> object);
+    void release(Handle<T> handle);
+    void clear();
+
+    T* get(Handle<T> handle) const;
+    void get(std::span<const Handle<T>> handles, std::span<T*> objects) const;
+
+    bool isAlive(Handle<T> handle) const { return get(handle) != nullptr; }
+    size_t size() const { return m_slots.size() - m_free_slots.size(); }
+
+private:
+    struct slot_t {
+        Shared<T> object;
+        uint32_t  generation{0};
+    };
+
+    std::vector<slot_t>   m_slots;
+    std::vector<uint32_t> m_free_slots;
+};
+
+template<typename T>
+Handle<T> HandlePool<T>::insert(Shared<T> object)
+{
+    if (object == nullptr) {
+        return {};
+    }
+
+    if (m_free_slots.empty()) {
+        m_slots.push_back({std::move(object)});
+        return {static_cast<uint32_t>(m_slots.size() - 1), 0};
+    }
+
+    auto index = m_free_slots.back();
+    m_free_slots.pop_back();
+    m_slots[index].object = std::move(object);
+    return {index, m_slots[index].generation};
+}
+
+template<typename T>
+void HandlePool<T>::release(Handle<T> handle)
+{
+    if (!isAlive(handle)) {
+        return;
+    }
+
+    auto& slot = m_slots[handle.index];
+    slot.object.reset();
+    slot.generation++;
+    m_free_slots.push_back(handle.index);
+}
+
+template<typename T>
+void HandlePool<T>::clear()
+{
+    for (uint32_t index{0}; index < m_slots.size(); ++index) {
+        release({index, m_slots[index].generation});
+    }
+}
+
+template<typename T>
+T* HandlePool<T>::get(Handle<T> handle) const
+{
+    if (handle.index >= m_slots.size()) {
+        return nullptr;
+    }
+
+    const auto& slot = m_slots[handle.index];
+    return slot.generation == handle.generation ? slot.object.get() : nullptr;
+}
+
+template<typename T>
+void HandlePool<T>::get(std::span<const Handle<T>> handles, std::span<T*> objects) const
+{
+    GE_CORE_ASSERT(handles.size() == objects.size(), "Each handle needs one output object");
+
+    for (size_t i{0}; i < handles.size(); ++i) {
+        objects[i] = get(handles[i]);
+    }
+}
+
+} // namespace GE
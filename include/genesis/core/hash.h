@@ -32,7 +32,12 @@
 
 #pragma once
 
+#include <array>
+#include <bit>
+#include <cstdint>
 #include <functional>
+#include <string_view>
+#include <type_traits>
 
 namespace GE {
 
@@ -51,4 +56,32 @@ size_t combinedHash(const Args&... args)
     return seed;
 }
 
+// FNV-1a, which is stable between runs and can be evaluated at compile time
+constexpr uint64_t FNV_OFFSET_BASIS{14695981039346656037ULL};
+constexpr uint64_t FNV_PRIME{1099511628211ULL};
+
+// Feeds the bytes of the value's object representation into the hash
+template<typename T>
+constexpr uint64_t fnvHash(uint64_t hash, const T& value)
+{
+    static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values are hashed");
+
+    for (auto byte : std::bit_cast<std::array<uint8_t, sizeof(T)>>(value)) {
+        hash = (hash ^ byte) * FNV_PRIME;
+    }
+
+    return hash;
+}
+
+constexpr uint64_t stringHash(std::string_view string)
+{
+    uint64_t hash{FNV_OFFSET_BASIS};
+
+    for (char symbol : string) {
+        hash = fnvHash(hash, static_cast<uint8_t>(symbol));
+    }
+
+    return hash;
+}
+
 } // namespace GE
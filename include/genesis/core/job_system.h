@@ -0,0 +1,120 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2024, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <genesis/core/interface.h>
+#include <genesis/core/memory.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace GE {
+
+class GE_API JobSystem: public NonCopyable
+{
+public:
+    using Job = std::function<void(uint32_t worker_index)>;
+    using RangeJob = std::function<void(uint32_t begin, uint32_t end, uint32_t worker_index)>;
+
+    class Counter;
+
+    // The calling thread works as worker 0 while waiting, background threads are workers
+    // 1..worker_count-1. Jobs may spawn and wait for other jobs from any worker, but only one
+    // thread outside of the system is supposed to drive it.
+    explicit JobSystem(uint32_t worker_count);
+    ~JobSystem();
+
+    // A job is started once the dependency counter drops to zero. The counter, if any,
+    // is incremented immediately and decremented after the job finishes.
+    void run(Job job, Counter* counter = nullptr, Counter* dependency = nullptr);
+    void parallelFor(uint32_t item_count,
+                     uint32_t min_range,
+                     RangeJob job,
+                     Counter* counter,
+                     Counter* dependency = nullptr);
+
+    void wait(const Counter& counter);
+
+    uint32_t workerCount() const { return static_cast<uint32_t>(m_queues.size()); }
+
+private:
+    struct job_t {
+        Shared<RangeJob> task;
+        uint32_t         begin{0};
+        uint32_t         end{0};
+        Counter*         counter{nullptr};
+    };
+
+    struct worker_queue_t {
+        std::mutex        mutex;
+        std::deque<job_t> jobs;
+    };
+
+    void workerLoop(uint32_t worker_index);
+    void schedule(std::vector<job_t> jobs, Counter* dependency);
+    void submit(std::vector<job_t> jobs);
+    bool tryRunJob(uint32_t worker_index);
+    bool tryPopJob(uint32_t worker_index, job_t* job);
+    void runJob(const job_t& job, uint32_t worker_index);
+
+    uint32_t currentWorkerIndex() const;
+
+    std::vector<worker_queue_t> m_queues;
+    std::vector<std::thread>    m_threads;
+    std::atomic<uint32_t>       m_queued_job_count{0};
+    std::mutex                  m_sleep_mutex;
+    std::condition_variable     m_job_available;
+    bool                        m_is_stopped{false};
+};
+
+// A counter has to outlive every job it tracks or waits for
+class GE_API JobSystem::Counter: public NonCopyable
+{
+public:
+    bool isDone() const;
+
+private:
+    friend class JobSystem;
+
+    mutable std::mutex m_mutex;
+    uint32_t           m_pending{0};
+    std::vector<job_t> m_continuations;
+};
+
+} // namespace GE
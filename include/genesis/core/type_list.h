@@ -35,6 +35,7 @@
 #include <boost/mpl/contains.hpp>
 #include <boost/mpl/for_each.hpp>
 #include <boost/mpl/list.hpp>
+#include <boost/mpl/size.hpp>
 
 namespace GE {
 
@@ -47,6 +48,12 @@ constexpr void forEachType(Callback&& callback)
     boost::mpl::for_each<TL>(std::forward<Callback>(callback));
 }
 
+template<typename TL>
+constexpr size_t typeListSize()
+{
+    return boost::mpl::size<TL>::value;
+}
+
 template<typename TL, typename T>
 constexpr bool isListContains()
 {
@@ -34,6 +34,7 @@
 
 #include <genesis/core/export.h>
 #include <genesis/core/memory.h>
+#include <genesis/math/aabb.h>
 
 namespace tinyobj {
 class ObjReader;
@@ -52,19 +53,21 @@ public:
     ~Mesh();
 
     bool fromObj(std::string_view filepath);
-    void setBuffers(Scoped<VertexBuffer> vbo, Scoped<IndexBuffer> ibo);
+    void setBuffers(Scoped<VertexBuffer> vbo, Scoped<IndexBuffer> ibo, const aabb_t& bounds = {});
     void destroy();
 
     void draw(GPUCommandQueue* queue) const;
 
     const Scoped<VertexBuffer>& vertexBuffer() const { return m_vbo; }
     const Scoped<IndexBuffer>& indexBuffer() const { return m_ibo; }
+    const aabb_t& bounds() const { return m_bounds; }
 
 private:
     bool populateBuffers(const tinyobj::ObjReader& reader);
 
     Scoped<VertexBuffer> m_vbo;
     Scoped<IndexBuffer>  m_ibo;
+    aabb_t               m_bounds;
 };
 
 } // namespace GE
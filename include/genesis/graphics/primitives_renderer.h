@@ -36,6 +36,9 @@
 #include <genesis/core/memory.h>
 #include <genesis/math/types.h>
 
+#include <array>
+#include <vector>
+
 namespace GE {
 
 class IndexBuffer;
@@ -49,17 +52,29 @@ public:
     explicit PrimitivesRenderer(Renderer* renderer);
     ~PrimitivesRenderer();
 
-    void begin();
-    void end();
-
-    void renderCircle(const Mat4& transform, const Vec4& color);
-    void renderSquare(const Mat4& transform, const Vec4& color);
+    // Lines are collected in world space and drawn by renderLines() with a single call
+    void addLine(const Vec2& from, const Vec2& to, const Vec4& color);
+    void addSquare(const Mat4& transform, const Vec4& color);
+    void addCircle(const Vec2& center, float radius, const Vec4& color);
+    void renderLines(const Mat4& view_projection);
 
 private:
-    Renderer*            m_renderer{nullptr};
-    Scoped<Pipeline>     m_pipeline;
-    Scoped<VertexBuffer> m_circle_vbo;
-    Scoped<VertexBuffer> m_square_vbo;
+    struct line_vertex_t {
+        Vec2 position;
+        Vec4 color;
+    };
+
+    // A frame may still be reading the previous buffers, so the batch cycles through several
+    static constexpr uint32_t LINE_VBO_COUNT{3};
+
+    Scoped<VertexBuffer>& nextLineVBO(uint32_t size);
+
+    Renderer*                                        m_renderer{nullptr};
+    Scoped<Pipeline>                                 m_lines_pipeline;
+    std::array<Scoped<VertexBuffer>, LINE_VBO_COUNT> m_line_vbos;
+    uint32_t                                         m_line_vbo_index{0};
+    std::vector<line_vertex_t>                       m_line_vertices;
+    std::vector<Vec2>                                m_circle_points;
 };
 
 } // namespace GE
@@ -71,6 +71,13 @@ public:
               uint32_t instance_count,
               uint32_t first_vertex,
               uint32_t first_instance);
+    // Draws with the buffers of the previous bind() calls, so a mesh drawn several times in a
+    // row is bound once
+    void drawIndexed(uint32_t index_count,
+                     uint32_t instance_count = 1,
+                     uint32_t first_index = 0,
+                     int32_t  vertex_offset = 0,
+                     uint32_t first_instance = 0);
 
     void submit(GPUCommandBuffer cmd);
 
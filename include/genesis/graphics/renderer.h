@@ -33,17 +33,28 @@
 #pragma once
 
 #include <genesis/core/interface.h>
+#include <genesis/core/memory.h>
 #include <genesis/graphics/render_command.h>
 #include <genesis/math/types.h>
 
+#include <functional>
+#include <future>
+#include <vector>
+
 namespace GE {
 
 class Event;
 class GPUCommandQueue;
+class IndexBuffer;
 class Pipeline;
 class RenderCommand;
+class Texture;
+class UniformBuffer;
+class VertexBuffer;
 struct pipeline_config_t;
 
+using ReadbackCallback = std::function<void(const void* data, uint32_t size)>;
+
 class GE_API Renderer: public Interface
 {
 public:
@@ -60,6 +71,13 @@ public:
                       uint32_t         instance_count,
                       uint32_t         first_vertex,
                       uint32_t         first_instance) = 0;
+    // Draws with the vertex and index buffers bound before
+    virtual void drawIndexed(GPUCommandQueue* queue,
+                             uint32_t         index_count,
+                             uint32_t         instance_count,
+                             uint32_t         first_index,
+                             int32_t          vertex_offset,
+                             uint32_t         first_instance) = 0;
 
     virtual bool beginFrame(ClearMode clear_mode = CLEAR_ALL) = 0;
     virtual void endFrame() = 0;
@@ -71,6 +89,42 @@ public:
     virtual RenderCommand* command() = 0;
 
     virtual Scoped<Pipeline> createPipeline(const pipeline_config_t& config) = 0;
+
+    // The copy is recorded at the end of the current frame, the callback is called once
+    // the GPU has finished the frame
+    virtual void enqueueReadback(const Texture&   texture,
+                                 const Vec2&      offset,
+                                 const Vec2&      size,
+                                 ReadbackCallback callback) = 0;
+    virtual void enqueueReadback(const VertexBuffer& buffer,
+                                 uint32_t            offset,
+                                 uint32_t            size,
+                                 ReadbackCallback    callback) = 0;
+    virtual void enqueueReadback(const IndexBuffer& buffer,
+                                 uint32_t           offset,
+                                 uint32_t           size,
+                                 ReadbackCallback   callback) = 0;
+    virtual void enqueueReadback(const UniformBuffer& buffer,
+                                 uint32_t             offset,
+                                 uint32_t             size,
+                                 ReadbackCallback     callback) = 0;
+    // Calls the callbacks of the finished readbacks without waiting for the GPU, so a renderer
+    // that isn't drawn every frame can still deliver them
+    virtual void pollReadbacks() = 0;
+
+    std::future<std::vector<uint8_t>>
+    readback(const Texture& texture, const Vec2& offset, const Vec2& size)
+    {
+        auto promise = makeShared<std::promise<std::vector<uint8_t>>>();
+        auto future = promise->get_future();
+
+        enqueueReadback(texture, offset, size, [promise](const void* data, uint32_t data_size) {
+            const auto* bytes = static_cast<const uint8_t*>(data);
+            promise->set_value({bytes, bytes + data_size});
+        });
+
+        return future;
+    }
 };
 
 } // namespace GE
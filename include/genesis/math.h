@@ -32,6 +32,7 @@
 
 #pragma once
 
+#include <genesis/math/aabb.h>
 #include <genesis/math/camera.h>
 #include <genesis/math/linear.h>
 #include <genesis/math/transform.h>
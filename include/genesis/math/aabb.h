@@ -0,0 +1,181 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2024, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <genesis/math/types.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
+namespace GE {
+
+struct aabb_t {
+    Vec3 min{std::numeric_limits<float>::max()};
+    Vec3 max{std::numeric_limits<float>::lowest()};
+
+    bool isValid() const { return min.x <= max.x && min.y <= max.y && min.z <= max.z; }
+
+    Vec3 center() const { return (min + max) * 0.5f; }
+    Vec3 extent() const { return (max - min) * 0.5f; }
+
+    float area() const
+    {
+        auto size = max - min;
+        return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+    }
+
+    void expand(const Vec3& point)
+    {
+        min = glm::min(min, point);
+        max = glm::max(max, point);
+    }
+
+    aabb_t merged(const aabb_t& other) const
+    {
+        return {glm::min(min, other.min), glm::max(max, other.max)};
+    }
+
+    aabb_t fattened(float margin) const { return {min - Vec3{margin}, max + Vec3{margin}}; }
+
+    bool contains(const Vec3& point) const
+    {
+        return point.x >= min.x && point.x <= max.x && point.y >= min.y && point.y <= max.y &&
+               point.z >= min.z && point.z <= max.z;
+    }
+
+    bool contains(const aabb_t& other) const
+    {
+        return other.min.x >= min.x && other.min.y >= min.y && other.min.z >= min.z &&
+               other.max.x <= max.x && other.max.y <= max.y && other.max.z <= max.z;
+    }
+
+    bool overlaps(const aabb_t& other) const
+    {
+        return min.x <= other.max.x && max.x >= other.min.x && min.y <= other.max.y &&
+               max.y >= other.min.y && min.z <= other.max.z && max.z >= other.min.z;
+    }
+
+    bool overlaps2D(const aabb_t& other) const
+    {
+        return min.x <= other.max.x && max.x >= other.min.x && min.y <= other.max.y &&
+               max.y >= other.min.y;
+    }
+};
+
+inline aabb_t transformAabb(const aabb_t& box, const Mat4& transform)
+{
+    Vec3   translation{transform[3]};
+    aabb_t result{translation, translation};
+
+    for (int col{0}; col < 3; col++) {
+        for (int row{0}; row < 3; row++) {
+            float a = transform[col][row] * box.min[col];
+            float b = transform[col][row] * box.max[col];
+            result.min[row] += std::min(a, b);
+            result.max[row] += std::max(a, b);
+        }
+    }
+
+    return result;
+}
+
+// Returns a distance along 'direction' to the first intersection, or a negative value
+inline float rayIntersection(const aabb_t& box, const Vec3& origin, const Vec3& direction)
+{
+    float t_min{0.0f};
+    float t_max{std::numeric_limits<float>::max()};
+
+    for (int axis{0}; axis < 3; axis++) {
+        if (std::abs(direction[axis]) < std::numeric_limits<float>::epsilon()) {
+            if (origin[axis] < box.min[axis] || origin[axis] > box.max[axis]) {
+                return -1.0f;
+            }
+
+            continue;
+        }
+
+        float inv_direction = 1.0f / direction[axis];
+        float t0 = (box.min[axis] - origin[axis]) * inv_direction;
+        float t1 = (box.max[axis] - origin[axis]) * inv_direction;
+
+        if (t0 > t1) {
+            std::swap(t0, t1);
+        }
+
+        t_min = std::max(t_min, t0);
+        t_max = std::min(t_max, t1);
+
+        if (t_min > t_max) {
+            return -1.0f;
+        }
+    }
+
+    return t_min;
+}
+
+struct frustum_t {
+    std::array<Vec4, 6> planes{};
+
+    static frustum_t fromViewProjection(const Mat4& vp)
+    {
+        auto row = [&vp](int i) { return Vec4{vp[0][i], vp[1][i], vp[2][i], vp[3][i]}; };
+
+        frustum_t frustum{};
+        frustum.planes[0] = row(3) + row(0); // Left
+        frustum.planes[1] = row(3) - row(0); // Right
+        frustum.planes[2] = row(3) + row(1); // Bottom
+        frustum.planes[3] = row(3) - row(1); // Top
+        frustum.planes[4] = row(2);          // Near, depth range is [0, 1]
+        frustum.planes[5] = row(3) - row(2); // Far
+        return frustum;
+    }
+
+    bool intersects(const aabb_t& box) const
+    {
+        for (const auto& plane : planes) {
+            Vec3 positive{plane.x >= 0.0f ? box.max.x : box.min.x,
+                          plane.y >= 0.0f ? box.max.y : box.min.y,
+                          plane.z >= 0.0f ? box.max.z : box.min.z};
+
+            if (glm::dot(Vec3{plane}, positive) + plane.w < 0.0f) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+};
+
+} // namespace GE
@@ -39,6 +39,7 @@ namespace GE {
 
 using glm::affineInverse;
 using glm::inverse;
+using glm::length;
 using glm::normalize;
 using glm::transpose;
 
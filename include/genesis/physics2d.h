@@ -34,4 +34,6 @@
 
 #include <genesis/physics2d/rigid_body.h>
 #include <genesis/physics2d/rigid_body_shape.h>
+#include <genesis/physics2d/snapshot.h>
 #include <genesis/physics2d/world.h>
+#include <genesis/physics2d/world_query.h>
@@ -41,6 +41,20 @@
 
 namespace GE::P2D {
 
+struct pose_t {
+    Vec2  position{0.0f, 0.0f};
+    float angle{0.0f};
+};
+
+// The rotation is Box2D's cosine and sine pair, an angle would not restore it bit-exactly
+struct body_state_t {
+    Vec2  position{0.0f, 0.0f};
+    Vec2  rotation{1.0f, 0.0f};
+    Vec2  linear_velocity{0.0f, 0.0f};
+    float angular_velocity{0.0f};
+    bool  is_awake{true};
+};
+
 class GE_API RigidBody: public NonCopyable
 {
 public:
@@ -55,10 +69,15 @@ public:
     virtual void createShape(const circle_body_shape_config_t& shape_config) = 0;
 
     virtual void setFixedRotation(bool flag) = 0;
+    virtual void setUserData(uint64_t user_data) = 0;
+    virtual void setState(const body_state_t& state) = 0;
 
     virtual bool isFixedRotation() const = 0;
     virtual Vec2 position() const = 0;
     virtual float angle() const = 0;
+    virtual pose_t pose() const = 0;
+    virtual uint64_t userData() const = 0;
+    virtual body_state_t state() const = 0;
 };
 
 inline RigidBody::Type toRigidBodyType(std::string_view type_string)
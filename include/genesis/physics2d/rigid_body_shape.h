@@ -34,12 +34,29 @@
 
 #include <genesis/math/types.h>
 
+#include <cstdint>
+#include <limits>
+
 namespace GE::P2D {
 
+// A shape is reported to another shape or a query only if each one's category bits are in the
+// other's mask bits
+struct collision_filter_t {
+    static constexpr uint64_t DEFAULT_CATEGORY{1};
+    static constexpr uint64_t ALL_CATEGORIES{std::numeric_limits<uint64_t>::max()};
+
+    uint64_t category_bits{DEFAULT_CATEGORY};
+    uint64_t mask_bits{ALL_CATEGORIES};
+};
+
 struct body_shape_config_base_t {
     float friction{0.5f};
     float restitution{0.0f};
     float density{1.0f};
+    bool  is_sensor{false};
+    bool  enable_hit_events{false};
+
+    collision_filter_t filter;
 };
 
 struct box_body_shape_config_t: body_shape_config_base_t {
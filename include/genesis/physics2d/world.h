@@ -37,19 +37,115 @@
 #include <genesis/core/timestamp.h>
 #include <genesis/math/types.h>
 #include <genesis/physics2d/rigid_body.h>
+#include <genesis/physics2d/world_query.h>
+
+#include <span>
+#include <vector>
 
 namespace GE::P2D {
 
+struct thread_config_t {
+    uint32_t worker_count{1};
+};
+
+struct body_def_t {
+    RigidBody::Type type{RigidBody::Type::STATIC};
+    pose_t          pose;
+    bool            fixed_rotation{false};
+    uint64_t        user_data{0};
+};
+
+// The body is an index into the body definitions passed along with the shape
+struct box_shape_def_t {
+    uint32_t                body{0};
+    box_body_shape_config_t config;
+};
+
+struct circle_shape_def_t {
+    uint32_t                   body{0};
+    circle_body_shape_config_t config;
+};
+
+struct body_move_event_t {
+    pose_t   pose;
+    uint64_t user_data{0};
+};
+
+struct contact_event_t {
+    uint64_t user_data_a{0};
+    uint64_t user_data_b{0};
+};
+
+struct contact_hit_event_t {
+    uint64_t user_data_a{0};
+    uint64_t user_data_b{0};
+    Vec2     point{0.0f, 0.0f};
+    Vec2     normal{0.0f, 0.0f};
+    float    approach_speed{0.0f};
+};
+
+struct sensor_event_t {
+    uint64_t sensor_user_data{0};
+    uint64_t visitor_user_data{0};
+};
+
+struct contact_events_t {
+    std::vector<contact_event_t>     begin_events;
+    std::vector<contact_event_t>     end_events;
+    std::vector<contact_hit_event_t> hit_events;
+    std::vector<sensor_event_t>      sensor_begin_events;
+    std::vector<sensor_event_t>      sensor_end_events;
+
+    void clear()
+    {
+        begin_events.clear();
+        end_events.clear();
+        hit_events.clear();
+        sensor_begin_events.clear();
+        sensor_end_events.clear();
+    }
+};
+
 class World: public NonCopyable
 {
 public:
     virtual void step(Timestamp ts, int32_t sub_step_count) = 0;
 
+    // Bodies moved by the last step, the user data is the one set on the body
+    virtual const std::vector<body_move_event_t>& bodyMoveEvents() const = 0;
+    // Contacts, hits and sensor overlaps reported by the last step, mapped to the bodies' user data
+    virtual const contact_events_t& contactEvents() const = 0;
+
+    // Queries see the state left by the last step. They may run concurrently with each other, but
+    // not with step(). Overlaps report the user data of the bodies, once per overlapping shape.
+    virtual cast_hit_t castRayClosest(const ray_cast_t& ray) const = 0;
+    virtual void castRay(const ray_cast_t& ray, std::vector<cast_hit_t>* hits) const = 0;
+    virtual cast_hit_t castShape(const box_cast_t& cast) const = 0;
+    virtual cast_hit_t castShape(const circle_cast_t& cast) const = 0;
+    virtual void overlap(const aabb_overlap_t& query, std::vector<uint64_t>* user_data) const = 0;
+    virtual void overlap(const box_overlap_t& query, std::vector<uint64_t>* user_data) const = 0;
+    virtual void overlap(const circle_overlap_t& query,
+                         std::vector<uint64_t>*  user_data) const = 0;
+
+    // Batch queries are split across the world's workers, results[i] answers queries[i]. They
+    // are issued from the thread stepping the world.
+    virtual void castRaysClosest(std::span<const ray_cast_t> rays,
+                                 std::span<cast_hit_t>       hits) = 0;
+    virtual void overlap(std::span<const aabb_overlap_t>  queries,
+                         std::span<std::vector<uint64_t>> user_data) = 0;
+
+    // The user data is reported by queries and events, so it is set before the body goes live
     virtual Scoped<RigidBody> createRigidBody(RigidBody::Type type,
                                               const Vec2&     position,
-                                              float           angle) = 0;
+                                              float           angle,
+                                              uint64_t        user_data) = 0;
+    // Creates the bodies with their shapes in one go, the result is in the order of the definitions
+    virtual std::vector<Scoped<RigidBody>> createRigidBodies(
+        std::span<const body_def_t>         bodies,
+        std::span<const box_shape_def_t>    boxes,
+        std::span<const circle_shape_def_t> circles) = 0;
 
-    static Scoped<World> create(const Vec2& gravity);
+    static Scoped<World> create(const Vec2& gravity, const thread_config_t& threads = {});
 };
 
 } // namespace GE::P2D
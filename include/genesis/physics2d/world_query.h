@@ -0,0 +1,91 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2024, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <genesis/math/aabb.h>
+#include <genesis/math/types.h>
+#include <genesis/physics2d/rigid_body.h>
+#include <genesis/physics2d/rigid_body_shape.h>
+
+#include <cstdint>
+
+namespace GE::P2D {
+
+struct ray_cast_t {
+    Vec2               origin{0.0f, 0.0f};
+    Vec2               translation{0.0f, 0.0f};
+    collision_filter_t filter;
+};
+
+// The fraction is the part of the cast translation travelled before the hit
+struct cast_hit_t {
+    uint64_t user_data{0};
+    Vec2     point{0.0f, 0.0f};
+    Vec2     normal{0.0f, 0.0f};
+    float    fraction{1.0f};
+    bool     hit{false};
+};
+
+struct box_cast_t {
+    box_body_shape_config_t shape;
+    pose_t                  pose;
+    Vec2                    translation{0.0f, 0.0f};
+    collision_filter_t      filter;
+};
+
+struct circle_cast_t {
+    circle_body_shape_config_t shape;
+    pose_t                     pose;
+    Vec2                       translation{0.0f, 0.0f};
+    collision_filter_t         filter;
+};
+
+// Only x and y of the bounds are used
+struct aabb_overlap_t {
+    aabb_t             bounds;
+    collision_filter_t filter;
+};
+
+struct box_overlap_t {
+    box_body_shape_config_t shape;
+    pose_t                  pose;
+    collision_filter_t      filter;
+};
+
+struct circle_overlap_t {
+    circle_body_shape_config_t shape;
+    pose_t                     pose;
+    collision_filter_t         filter;
+};
+
+} // namespace GE::P2D
@@ -35,6 +35,7 @@
 #include <genesis/scene/camera/projection_camera.h>
 #include <genesis/scene/camera/view_projection_camera.h>
 #include <genesis/scene/camera/vp_camera_controller.h>
+#include <genesis/scene/command_buffer.h>
 #include <genesis/scene/component_list.h>
 #include <genesis/scene/components.h>
 #include <genesis/scene/entity.h>
@@ -42,9 +43,14 @@
 #include <genesis/scene/entity_node.h>
 #include <genesis/scene/entity_picker.h>
 #include <genesis/scene/executor.h>
+#include <genesis/scene/headless_runner.h>
+#include <genesis/scene/name_index.h>
 #include <genesis/scene/pipeline_library.h>
+#include <genesis/scene/prefab.h>
 #include <genesis/scene/registry.h>
 #include <genesis/scene/renderer.h>
 #include <genesis/scene/scene.h>
 #include <genesis/scene/scene_deserializer.h>
 #include <genesis/scene/scene_serializer.h>
+#include <genesis/scene/spatial_index.h>
+#include <genesis/scene/system_scheduler.h>
@@ -0,0 +1,290 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2024, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <genesis/core/export.h>
+#include <genesis/core/interface.h>
+#include <genesis/core/memory.h>
+#include <genesis/scene/components/tag_component.h>
+#include <genesis/scene/entity.h>
+#include <genesis/scene/scene.h>
+
+#include <entt/core/type_info.hpp>
+
+#include <limits>
+#include <map>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace GE::Scene {
+
+// Records structural changes of a scene for a later playback. A buffer isn't synchronized, each
+// thread records into its own one. Playback merges the buffers and applies the commands in
+// phases: creation, component additions, replacements and removals batched by component type,
+// reparenting and destruction. Commands referring to entities destroyed before the playback are
+// skipped.
+class GE_API CommandBuffer: public NonCopyable
+{
+public:
+    static constexpr uint32_t NONE{std::numeric_limits<uint32_t>::max()};
+
+    // Refers either to an existing entity or to an entity created by the same buffer
+    struct entity_ref_t {
+        entity_ref_t() = default;
+        // NOLINTNEXTLINE(google-explicit-constructor)
+        entity_ref_t(const Entity& entity)
+            : handle{entity.nativeHandle()}
+        {}
+
+        Entity::NativeHandle handle{Entity::NULL_ID};
+        uint32_t             pending{NONE};
+    };
+
+    CommandBuffer();
+    ~CommandBuffer();
+
+    CommandBuffer(CommandBuffer&& other) noexcept;
+    CommandBuffer& operator=(CommandBuffer&& other) noexcept;
+
+    // Created entities are appended after the scene tail in the order of recording
+    entity_ref_t createEntity(std::string_view name = {});
+    // Destroys the entity with its children
+    void destroyEntity(const entity_ref_t& entity);
+    // Moves the entity to the children of the parent, a null parent moves it after the scene tail
+    void reparent(const entity_ref_t& entity, const entity_ref_t& parent);
+
+    // Adding to an entity that already has the component replaces it, of several additions of
+    // the same component to one entity the last recorded wins
+    template<typename T>
+    void addComponent(const entity_ref_t& entity, T component = {});
+    // Replacements notify the registry observers as Entity::patch() does
+    template<typename T>
+    void setComponent(const entity_ref_t& entity, T component);
+    template<typename T>
+    void removeComponent(const entity_ref_t& entity);
+
+    bool empty() const;
+    void clear();
+
+    void playback(Scene* scene);
+    static void playback(Scene* scene, std::span<CommandBuffer> buffers);
+
+private:
+    class ICommands;
+    template<typename T>
+    class Components;
+
+    struct reparent_t {
+        entity_ref_t entity;
+        entity_ref_t parent;
+    };
+
+    template<typename T>
+    Components<T>* components();
+
+    void resolve(std::span<const Entity::NativeHandle> created);
+
+    static Entity::NativeHandle resolve(const entity_ref_t&                   entity,
+                                        std::span<const Entity::NativeHandle> created);
+
+    std::vector<TagComponent>                  m_created;
+    std::vector<entity_ref_t>                  m_destroyed;
+    std::vector<reparent_t>                    m_reparented;
+    std::map<entt::id_type, Scoped<ICommands>> m_components;
+};
+
+class CommandBuffer::ICommands
+{
+public:
+    virtual ~ICommands() = default;
+
+    virtual bool empty() const = 0;
+    virtual void clear() = 0;
+    virtual void resolve(std::span<const Entity::NativeHandle> created) = 0;
+    // The batch consists of the commands of the same component type from all played buffers
+    virtual void playback(Scene* scene, std::span<ICommands* const> batch) = 0;
+};
+
+template<typename T>
+class CommandBuffer::Components: public ICommands
+{
+public:
+    void add(const entity_ref_t& entity, T&& component)
+    {
+        m_added.push_back(entity);
+        m_added_components.push_back(std::move(component));
+    }
+
+    void set(const entity_ref_t& entity, T&& component)
+    {
+        m_replaced.push_back(entity);
+        m_replaced_components.push_back(std::move(component));
+    }
+
+    void remove(const entity_ref_t& entity) { m_removed.push_back(entity); }
+
+    bool empty() const override
+    {
+        return m_added.empty() && m_replaced.empty() && m_removed.empty();
+    }
+
+    void clear() override
+    {
+        m_added.clear();
+        m_added_components.clear();
+        m_replaced.clear();
+        m_replaced_components.clear();
+        m_removed.clear();
+    }
+
+    void resolve(std::span<const Entity::NativeHandle> created) override
+    {
+        for (auto* entities : {&m_added, &m_replaced, &m_removed}) {
+            for (auto& entity : *entities) {
+                entity.handle = CommandBuffer::resolve(entity, created);
+            }
+        }
+    }
+
+    void playback(Scene* scene, std::span<ICommands* const> batch) override;
+
+private:
+    std::vector<entity_ref_t> m_added;
+    std::vector<T>            m_added_components;
+    std::vector<entity_ref_t> m_replaced;
+    std::vector<T>            m_replaced_components;
+    std::vector<entity_ref_t> m_removed;
+};
+
+template<typename T>
+void CommandBuffer::Components<T>::playback(Scene* scene, std::span<ICommands* const> batch)
+{
+    std::vector<Entity::NativeHandle>                entities;
+    std::vector<T>                                   components;
+    std::unordered_map<Entity::NativeHandle, size_t> added_indices;
+
+    // The registry asserts on inserting a component twice, so the additions are deduplicated and
+    // those for entities already having the component are played as replacements
+    for (auto* commands : batch) {
+        auto* typed_commands = static_cast<Components<T>*>(commands);
+
+        for (size_t i{0}; i < typed_commands->m_added.size(); i++) {
+            auto  handle = typed_commands->m_added[i].handle;
+            auto& component = typed_commands->m_added_components[i];
+
+            if (!scene->isValid(handle)) {
+                continue;
+            }
+
+            if (auto entity = scene->entity(handle); entity.template has<T>()) {
+                entity.template patch<T>(
+                    [&component](T& current) { current = std::move(component); });
+            } else if (auto [it, is_inserted] = added_indices.try_emplace(handle, entities.size());
+                       !is_inserted) {
+                components[it->second] = std::move(component);
+            } else {
+                entities.push_back(handle);
+                components.push_back(std::move(component));
+            }
+        }
+    }
+
+    if constexpr (std::is_copy_constructible_v<T>) {
+        scene->insertComponents<T>(entities, components);
+    } else {
+        for (size_t i{0}; i < entities.size(); i++) {
+            scene->entity(entities[i]).add<T>(std::move(components[i]));
+        }
+    }
+
+    for (auto* commands : batch) {
+        auto* typed_commands = static_cast<Components<T>*>(commands);
+
+        for (size_t i{0}; i < typed_commands->m_replaced.size(); i++) {
+            auto  handle = typed_commands->m_replaced[i].handle;
+            auto& component = typed_commands->m_replaced_components[i];
+
+            if (scene->isValid(handle)) {
+                scene->entity(handle).template patch<T>(
+                    [&component](T& current) { current = std::move(component); });
+            }
+        }
+    }
+
+    entities.clear();
+
+    for (auto* commands : batch) {
+        for (const auto& entity : static_cast<Components<T>*>(commands)->m_removed) {
+            if (scene->isValid(entity.handle)) {
+                entities.push_back(entity.handle);
+            }
+        }
+    }
+
+    scene->removeComponents<T>(entities);
+}
+
+template<typename T>
+void CommandBuffer::addComponent(const entity_ref_t& entity, T component)
+{
+    components<T>()->add(entity, std::move(component));
+}
+
+template<typename T>
+void CommandBuffer::setComponent(const entity_ref_t& entity, T component)
+{
+    components<T>()->set(entity, std::move(component));
+}
+
+template<typename T>
+void CommandBuffer::removeComponent(const entity_ref_t& entity)
+{
+    components<T>()->remove(entity);
+}
+
+template<typename T>
+CommandBuffer::Components<T>* CommandBuffer::components()
+{
+    auto& commands = m_components[entt::type_hash<T>::value()];
+
+    if (commands == nullptr) {
+        commands = makeScoped<Components<T>>();
+    }
+
+    return static_cast<Components<T>*>(commands.get());
+}
+
+} // namespace GE::Scene
@@ -40,6 +40,7 @@ namespace GE::Scene {
 using ComponentList = TypeList<CameraComponent,
                                TagComponent,
                                TransformComponent,
+                               SpriteResourcesComponent,
                                SpriteComponent,
                                MaterialComponent,
                                RigidBody2DComponent,
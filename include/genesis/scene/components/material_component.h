@@ -43,7 +43,7 @@ struct MaterialComponent {
     static constexpr std::string_view NAME{"Material"};
 
     const Assets::ResourceID& materialID() const { return m_material_id; }
-    void setMaterialID(Assets::ResourceID id) { m_material_id = std::move(id); }
+    void setMaterialID(Assets::ResourceID id) { m_material_id = id; }
 
     bool loadMaterial(Assets::Registry* assets);
 
@@ -53,7 +53,7 @@ private:
 
 inline bool MaterialComponent::loadMaterial(Assets::Registry* assets)
 {
-    pipeline_resource = assets->get<Assets::PipelineResource>(m_material_id);
+    pipeline_resource = assets->get<Assets::PipelineResource>(materialID());
     return pipeline_resource != nullptr;
 }
 
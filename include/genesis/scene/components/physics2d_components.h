@@ -44,6 +44,8 @@ struct RigidBody2DComponent {
     bool                 fixed_rotation{false};
 
     Scoped<P2D::RigidBody> body;
+    P2D::pose_t            previous_pose;
+    P2D::pose_t            current_pose;
 
     static constexpr std::string_view NAME{"Rigidbody 2D"};
 };
@@ -38,54 +38,49 @@
 
 namespace GE::Scene {
 
+// Only the handles and the color the renderer reads per frame live here, the resource IDs are
+// kept in SpriteResourcesComponent, so iterating sprites never pulls them into the cache
 struct GE_API SpriteComponent {
-    Shared<Texture> texture;
-    Shared<Mesh>    mesh;
-    Vec3            color{0.0f, 0.0f, 0.0f};
+    // Handles are resolved through the assets registry the sprite has been loaded with
+    Assets::TextureHandle texture;
+    Assets::MeshHandle    mesh;
+    Vec3                  color{0.0f, 0.0f, 0.0f};
 
     static constexpr std::string_view NAME{"Sprite"};
 
-    bool isValid() const { return texture && mesh; }
-
-    const Assets::ResourceID& textureID() const { return m_texture_id; }
-    const Assets::ResourceID& meshID() const { return m_mesh_id; }
+    bool isValid() const { return !texture.isNull() && !mesh.isNull(); }
+};
 
-    void setTextureID(Assets::ResourceID id) { m_texture_id = std::move(id); }
-    void setMeshID(Assets::ResourceID id) { m_mesh_id = std::move(id); }
+// Editor and serialization data of a sprite, stored apart from SpriteComponent
+struct GE_API SpriteResourcesComponent {
+    Assets::ResourceID texture;
+    Assets::ResourceID mesh;
 
-    bool loadTexture(Assets::Registry* assets);
-    bool loadMesh(Assets::Registry* assets);
-    bool loadAll(Assets::Registry* assets);
+    static constexpr std::string_view NAME{"SpriteResources"};
 
-private:
-    Assets::ResourceID m_texture_id;
-    Assets::ResourceID m_mesh_id;
+    bool loadTexture(SpriteComponent* sprite, Assets::Registry* assets) const;
+    bool loadMesh(SpriteComponent* sprite, Assets::Registry* assets) const;
+    bool loadAll(SpriteComponent* sprite, Assets::Registry* assets) const;
 };
 
-inline bool SpriteComponent::loadTexture(Assets::Registry* assets)
+inline bool SpriteResourcesComponent::loadTexture(SpriteComponent*  sprite,
+                                                  Assets::Registry* assets) const
 {
-    if (const auto& resource = assets->get<Assets::TextureResource>(m_texture_id);
-        resource != nullptr) {
-        texture = resource->texture();
-        return true;
-    }
-
-    return false;
+    sprite->texture = assets->textureHandle(texture);
+    return !sprite->texture.isNull();
 }
 
-inline bool SpriteComponent::loadMesh(Assets::Registry* assets)
+inline bool SpriteResourcesComponent::loadMesh(SpriteComponent*  sprite,
+                                               Assets::Registry* assets) const
 {
-    if (const auto& resource = assets->get<Assets::MeshResource>(m_mesh_id); resource != nullptr) {
-        mesh = resource->mesh();
-        return true;
-    }
-
-    return false;
+    sprite->mesh = assets->meshHandle(mesh);
+    return !sprite->mesh.isNull();
 }
 
-inline bool SpriteComponent::loadAll(Assets::Registry* assets)
+inline bool SpriteResourcesComponent::loadAll(SpriteComponent*  sprite,
+                                              Assets::Registry* assets) const
 {
-    return loadTexture(assets) && loadMesh(assets);
+    return loadTexture(sprite, assets) && loadMesh(sprite, assets);
 }
 
 } // namespace GE::Scene
@@ -32,14 +32,24 @@
 
 #pragma once
 
-#include <string>
+#include <genesis/core/string_table.h>
 
 namespace GE::Scene {
 
+// The name is interned, so the tag storage holds an integer per entity and the string lives in
+// the shared table. Renamed tags are never released, which is fine for editor-sized edits.
 struct TagComponent {
-    std::string tag;
+    TagComponent(std::string_view tag = {}) // NOLINT(google-explicit-constructor)
+        : m_tag{StringTable::intern(tag)}
+    {}
+
+    const std::string& tag() const { return StringTable::string(m_tag); }
+    void               setTag(std::string_view tag) { m_tag = StringTable::intern(tag); }
 
     static constexpr std::string_view NAME{"Tag"};
+
+private:
+    StringTable::ID m_tag{StringTable::EMPTY_ID};
 };
 
 } // namespace GE::Scene
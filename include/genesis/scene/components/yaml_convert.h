@@ -49,7 +49,7 @@ struct convert<GE::Scene::CameraComponent> {
 
     static bool decode(const Node& node, Component& camera)
     {
-        if (node["type"].as<std::string>() != TYPE) {
+        if (node["type"].Scalar() != TYPE) {
             return false;
         }
 
@@ -76,7 +76,7 @@ struct convert<GE::Scene::MaterialComponent> {
 
     static bool decode(const Node& node, Component& sprite)
     {
-        if (node["type"].as<std::string>() != TYPE) {
+        if (node["type"].Scalar() != TYPE) {
             return false;
         }
 
@@ -103,7 +103,7 @@ struct convert<GE::Scene::RigidBody2DComponent> {
 
     static bool decode(const Node& node, Component& rigid_body)
     {
-        if (node["type"].as<std::string>() != TYPE) {
+        if (node["type"].Scalar() != TYPE) {
             return false;
         }
 
@@ -129,6 +129,12 @@ struct convert<GE::P2D::body_shape_config_base_t> {
         shape.friction = node["friction"].as<float>();
         shape.restitution = node["restitution"].as<float>();
         shape.density = node["density"].as<float>();
+        shape.is_sensor = node["is_sensor"].as<bool>(false);
+        shape.enable_hit_events = node["enable_hit_events"].as<bool>(false);
+        shape.filter.category_bits = node["category_bits"].as<uint64_t>(
+            GE::P2D::collision_filter_t::DEFAULT_CATEGORY);
+        shape.filter.mask_bits =
+            node["mask_bits"].as<uint64_t>(GE::P2D::collision_filter_t::ALL_CATEGORIES);
         return true;
     }
 
@@ -138,6 +144,10 @@ struct convert<GE::P2D::body_shape_config_base_t> {
         node["friction"] = shape.friction;
         node["restitution"] = shape.restitution;
         node["density"] = shape.density;
+        node["is_sensor"] = shape.is_sensor;
+        node["enable_hit_events"] = shape.enable_hit_events;
+        node["category_bits"] = shape.filter.category_bits;
+        node["mask_bits"] = shape.filter.mask_bits;
         return node;
     }
 };
@@ -149,7 +159,7 @@ struct convert<GE::Scene::BoxCollider2DComponent> {
 
     static bool decode(const Node& node, Component& collider)
     {
-        if (node["type"].as<std::string>() != TYPE) {
+        if (node["type"].Scalar() != TYPE) {
             return false;
         }
 
@@ -185,7 +195,7 @@ struct convert<GE::Scene::CircleCollider2DComponent> {
 
     static bool decode(const Node& node, Component& collider)
     {
-        if (node["type"].as<std::string>() != TYPE) {
+        if (node["type"].Scalar() != TYPE) {
             return false;
         }
 
@@ -219,15 +229,11 @@ struct convert<GE::Scene::SpriteComponent> {
 
     static bool decode(const Node& node, Component& sprite)
     {
-        if (node["type"].as<std::string>() != TYPE) {
+        if (node["type"].Scalar() != TYPE) {
             return false;
         }
 
         sprite.color = node["color"].as<GE::Vec3>();
-
-        auto resources_node = node["resources"];
-        sprite.setTextureID(resources_node["texture"].as<GE::Assets::ResourceID>());
-        sprite.setMeshID(resources_node["mesh"].as<GE::Assets::ResourceID>());
         return true;
     }
 
@@ -236,11 +242,32 @@ struct convert<GE::Scene::SpriteComponent> {
         YAML::Node node;
         node["type"] = TYPE.data();
         node["color"] = sprite.color;
+        return node;
+    }
+};
 
-        auto resources_node = node["resources"];
-        resources_node["texture"] = sprite.textureID();
-        resources_node["mesh"] = sprite.meshID();
+template<>
+struct convert<GE::Scene::SpriteResourcesComponent> {
+    using Component = GE::Scene::SpriteResourcesComponent;
+    static constexpr auto TYPE{Component ::NAME};
+
+    static bool decode(const Node& node, Component& resources)
+    {
+        if (node["type"].Scalar() != TYPE) {
+            return false;
+        }
 
+        resources.texture = node["texture"].as<GE::Assets::ResourceID>();
+        resources.mesh = node["mesh"].as<GE::Assets::ResourceID>();
+        return true;
+    }
+
+    static Node encode(const Component& resources)
+    {
+        YAML::Node node;
+        node["type"] = TYPE.data();
+        node["texture"] = resources.texture;
+        node["mesh"] = resources.mesh;
         return node;
     }
 };
@@ -252,11 +279,11 @@ struct convert<GE::Scene::TagComponent> {
 
     static bool decode(const Node& node, Component& tag)
     {
-        if (node["type"].as<std::string>() != TYPE) {
+        if (node["type"].Scalar() != TYPE) {
             return false;
         }
 
-        tag.tag = node["tag"].as<std::string>();
+        tag.setTag(node["tag"].as<std::string>());
         return true;
     }
 
@@ -264,7 +291,7 @@ struct convert<GE::Scene::TagComponent> {
     {
         YAML::Node node;
         node["type"] = TYPE.data();
-        node["tag"] = tag.tag;
+        node["tag"] = tag.tag();
         return node;
     }
 };
@@ -276,7 +303,7 @@ struct convert<GE::Scene::TransformComponent> {
 
     static bool decode(const Node& node, Component& transform)
     {
-        if (node["type"].as<std::string>() != TYPE) {
+        if (node["type"].Scalar() != TYPE) {
             return false;
         }
 
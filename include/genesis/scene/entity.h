@@ -71,6 +71,14 @@ public:
         m_registry->remove<T>(m_handle);
     }
 
+    // Unlike a write through get(), patching notifies the registry observers
+    template<typename T, typename... Func>
+    void patch(Func&&... func)
+    {
+        GE_CORE_ASSERT(has<T>(), "Unable to patch non-existent '{}' component", T::NAME);
+        m_registry->patch<T>(m_handle, std::forward<Func>(func)...);
+    }
+
     template<typename T>
     T& get()
     {
@@ -70,13 +70,14 @@ public:
     const Entity& entity() const { return m_entity; }
 
     void destoryEntityWithChildren(Scene* scene);
+    // Unlinks the entity from its parent and siblings, the children stay attached to it
+    void eject();
 
 private:
     void moveHeadToNextNode();
     void moveTailToPrevNode();
     void moveTailToNextNode();
-
-    void eject();
+    void notifyParentChanged();
 
     NodeComponent& node();
     const NodeComponent& node() const;
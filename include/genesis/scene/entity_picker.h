@@ -36,10 +36,12 @@
 #include <genesis/core/memory.h>
 #include <genesis/math/types.h>
 
+#include <functional>
+#include <vector>
+
 namespace GE {
 class Framebuffer;
 class Pipeline;
-class StagingBuffer;
 class Texture;
 } // namespace GE
 
@@ -56,28 +58,36 @@ class ViewProjectionCamera;
 class GE_API EntityPicker
 {
 public:
+    using PickCallback = std::function<void(const Entity& entity)>;
+
     EntityPicker(Scene* scene, const Assets::Registry& assets, const ViewProjectionCamera* camera);
     ~EntityPicker();
 
-    void onRender();
-    void onViewportUpdate(const Vec2& viewport);
-
-    Entity getEntityByPosition(const Vec2& position);
+    // The region under the position is rendered at once, the callback receives the entity or a
+    // null one from a later poll(), after the GPU has finished the region
+    void pickEntity(const Vec2& position, PickCallback callback);
+    // Doesn't wait for the GPU, called once per frame
+    void poll();
+    std::vector<Entity> getEntitiesInRect(const Vec2& first_corner,
+                                          const Vec2& second_corner) const;
 
     static constexpr int32_t ENTITY_ID_NONE{-1};
+    static constexpr Vec2    PICK_REGION_SIZE{1.0f, 1.0f};
 
 private:
-    void recreateEntityIdFramebuffer(const Vec2& size);
+    void createEntityIdFramebuffer();
     void createEntityIdPipeline(const Assets::Registry& assets);
 
-    void renderEntityId(const Entity& entity);
+    void renderPickRegion(const Vec2& position, PickCallback callback);
+    void renderEntityId(const Mat4& view_projection, const Entity& entity);
+    Mat4 pickRegionViewProjection(const Vec2& position) const;
+    Vec3 toWorldPosition(const Vec2& position) const;
 
     Scene*                      m_scene{nullptr};
+    const Assets::Registry*     m_assets{nullptr};
     const ViewProjectionCamera* m_camera{nullptr};
     Scoped<Framebuffer>         m_entity_id_fbo;
     Scoped<Pipeline>            m_entity_id_pipeline;
-    Scoped<StagingBuffer>       m_entity_id_buffer;
-    bool                        m_is_buffer_updated{false};
 };
 
 } // namespace GE::Scene
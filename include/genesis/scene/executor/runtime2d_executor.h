@@ -33,20 +33,69 @@
 #pragma once
 
 #include <genesis/core/memory.h>
+#include <genesis/math/types.h>
+#include <genesis/scene/entity.h>
 #include <genesis/scene/executor/iexecutor.h>
 
+#include <span>
+#include <utility>
+#include <vector>
+
 namespace GE::P2D {
 class World;
+struct contact_events_t;
 } // namespace GE::P2D
 
 namespace GE::Scene {
 
 class Scene;
 
+struct contact2d_t {
+    Entity::NativeHandle entity_a{Entity::NULL_ID};
+    Entity::NativeHandle entity_b{Entity::NULL_ID};
+};
+
+struct contact2d_hit_t {
+    Entity::NativeHandle entity_a{Entity::NULL_ID};
+    Entity::NativeHandle entity_b{Entity::NULL_ID};
+    Vec2                 point{0.0f, 0.0f};
+    Vec2                 normal{0.0f, 0.0f};
+    float                approach_speed{0.0f};
+};
+
+struct sensor2d_overlap_t {
+    Entity::NativeHandle sensor{Entity::NULL_ID};
+    Entity::NativeHandle visitor{Entity::NULL_ID};
+};
+
+// Collision feedback of all the steps run by one update, handed to systems in bulk
+struct contact2d_events_t {
+    std::vector<contact2d_t>        begin_contacts;
+    std::vector<contact2d_t>        end_contacts;
+    std::vector<contact2d_hit_t>    hits;
+    std::vector<sensor2d_overlap_t> sensor_begins;
+    std::vector<sensor2d_overlap_t> sensor_ends;
+
+    void clear()
+    {
+        begin_contacts.clear();
+        end_contacts.clear();
+        hits.clear();
+        sensor_begins.clear();
+        sensor_ends.clear();
+    }
+};
+
 class GE_API Runtime2DExecutor: public IExecutor
 {
 public:
+    struct config_t {
+        double   step_rate{60.0};
+        uint32_t max_steps_per_update{4};
+    };
+
     Runtime2DExecutor(Scene* scene, P2D::World* physics_world);
+    Runtime2DExecutor(Scene* scene, P2D::World* physics_world, const config_t& config);
     ~Runtime2DExecutor();
 
     void onUpdate(Timestamp timestamp) override;
@@ -57,15 +106,36 @@ public:
     std::string_view type() const override { return TYPE; }
     bool isPaused() const override { return m_is_paused; }
 
+    const config_t& config() const { return m_config; }
+    float interpolationAlpha() const { return m_interpolation_alpha; }
+    const contact2d_events_t& contactEvents() const { return m_contact_events; }
+
+    // Restoring puts the simulation on a step boundary, the time left from the last update is
+    // dropped and the transforms are written back right away
+    void saveSnapshot(std::vector<uint8_t>* snapshot) const;
+    bool restoreSnapshot(std::span<const uint8_t> snapshot);
+
     static constexpr std::string_view TYPE{"Runtime 2D"};
 
 private:
     void initializePhysics2D();
     void resetRigidBody2D();
+    void storePreviousPoses();
+    void applyBodyMoveEvents(bool is_last_step);
+    void appendContactEvents(const P2D::contact_events_t& events);
+    void updateTransforms();
 
-    Scene*      m_scene{nullptr};
-    P2D::World* m_world{nullptr};
-    bool        m_is_paused{false};
+    Scene*                                                 m_scene{nullptr};
+    P2D::World*                                            m_world{nullptr};
+    config_t                                               m_config;
+    Timestamp                                              m_accumulator;
+    float                                                  m_interpolation_alpha{0.0f};
+    bool                                                   m_is_paused{false};
+    contact2d_events_t                                     m_contact_events;
+    std::vector<Entity::NativeHandle>                      m_bodies;
+    std::vector<Entity::NativeHandle>                      m_moving_bodies;
+    std::vector<Entity::NativeHandle>                      m_updated_bodies;
+    std::vector<std::pair<uint32_t, Entity::NativeHandle>> m_depth_sorted_bodies;
 };
 
 } // namespace GE::Scene
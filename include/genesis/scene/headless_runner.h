@@ -0,0 +1,83 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2024, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <genesis/core/export.h>
+#include <genesis/core/timestamp.h>
+#include <genesis/math/types.h>
+#include <genesis/physics2d/world.h>
+
+#include <span>
+#include <string>
+#include <vector>
+
+namespace GE::Scene {
+
+class Scene;
+
+// Loads a scene without GPU resources and steps its physics for a fixed number of ticks, so
+// independent instances can run side by side on a machine without a display. Log::initialize()
+// and Log::shutdown() are expected to be called outside of the runs.
+class GE_API HeadlessRunner
+{
+public:
+    struct config_t {
+        std::string          scene_filepath;
+        uint32_t             tick_count{600};
+        double               tick_rate{60.0};
+        Vec2                 gravity{0.0f, -9.8f};
+        P2D::thread_config_t threads;
+    };
+
+    struct report_t {
+        bool      is_loaded{false};
+        uint32_t  tick_count{0};
+        uint64_t  state_hash{0};
+        Timestamp load_time;
+        Timestamp simulation_time;
+        Timestamp max_tick_time;
+    };
+
+    explicit HeadlessRunner(config_t config);
+
+    report_t run() const;
+
+    static std::vector<report_t> runParallel(std::span<const config_t> configs,
+                                             uint32_t                  thread_count);
+    static uint64_t stateHash(const Scene& scene);
+
+private:
+    config_t m_config;
+};
+
+} // namespace GE::Scene
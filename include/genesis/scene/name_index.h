@@ -0,0 +1,158 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2024, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <genesis/core/export.h>
+#include <genesis/scene/entity.h>
+
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace GE::Scene {
+
+struct TagComponent;
+
+// Tags are tracked through the registry signals, so a tag has to be changed with Entity::patch()
+// to be reindexed
+class GE_API NameIndex
+{
+public:
+    using NativeHandle = Entity::NativeHandle;
+
+    void insert(NativeHandle entity, std::string_view name);
+    void remove(NativeHandle entity);
+    void clear();
+
+    bool contains(NativeHandle entity) const { return m_slots.contains(entity); }
+    size_t size() const { return m_entries.size(); }
+
+    NativeHandle find(std::string_view name) const;
+    // The span is valid until the index is changed
+    std::span<const NativeHandle> findAll(std::string_view name) const;
+
+    // Case-insensitive substring search, entities are reported in no particular order
+    template<typename Callback>
+    void search(std::string_view pattern, Callback&& callback) const;
+
+    void onComponentChanged(NativeHandle entity, const TagComponent& tag);
+    void onComponentRemoved(NativeHandle entity) { remove(entity); }
+
+    // Bigrams and trigrams are indexed, shorter patterns are matched by a linear scan
+    static constexpr size_t MIN_GRAM_SIZE{2};
+    static constexpr size_t MAX_GRAM_SIZE{3};
+
+private:
+    using Gram = uint32_t;
+
+    struct entry_t {
+        NativeHandle entity{Entity::NULL_ID};
+        std::string  name;
+        std::string  folded_name;
+        uint32_t     name_slot{0};
+        uint32_t     stamp{0};
+        uint32_t     gram_count{0};
+    };
+
+    struct posting_t {
+        NativeHandle entity{Entity::NULL_ID};
+        uint32_t     stamp{0};
+    };
+
+    struct string_hash_t {
+        using is_transparent = void;
+
+        size_t operator()(std::string_view string) const
+        {
+            return std::hash<std::string_view>{}(string);
+        }
+    };
+
+    using NameMap = std::unordered_map<std::string, std::vector<NativeHandle>, string_hash_t,
+                                       std::equal_to<>>;
+
+    void assignName(entry_t* entry, std::string_view name);
+    void linkName(entry_t* entry);
+    void unlinkName(const entry_t& entry);
+    void indexGrams(entry_t* entry);
+    void retireGrams(const entry_t& entry);
+    void compactPostings();
+
+    const entry_t* liveEntry(const posting_t& posting) const;
+    const std::vector<posting_t>* rarestPostings(std::string_view folded_pattern) const;
+
+    static std::string foldCase(std::string_view string);
+    static Gram makeGram(std::string_view string);
+
+    static constexpr size_t MIN_STALE_POSTINGS{1024};
+
+    std::vector<entry_t>                             m_entries;
+    std::unordered_map<NativeHandle, uint32_t>       m_slots;
+    NameMap                                          m_names;
+    std::unordered_map<Gram, std::vector<posting_t>> m_postings;
+    size_t                                           m_posting_count{0};
+    size_t                                           m_stale_posting_count{0};
+    uint32_t                                         m_stamp{0};
+};
+
+template<typename Callback>
+void NameIndex::search(std::string_view pattern, Callback&& callback) const
+{
+    auto folded_pattern = foldCase(pattern);
+
+    if (folded_pattern.size() < MIN_GRAM_SIZE) {
+        for (const auto& entry : m_entries) {
+            if (entry.folded_name.find(folded_pattern) != std::string::npos) {
+                callback(entry.entity);
+            }
+        }
+
+        return;
+    }
+
+    const auto* postings = rarestPostings(folded_pattern);
+    if (postings == nullptr) {
+        return;
+    }
+
+    for (const auto& posting : *postings) {
+        const auto* entry = liveEntry(posting);
+        if (entry != nullptr && entry->folded_name.find(folded_pattern) != std::string::npos) {
+            callback(posting.entity);
+        }
+    }
+}
+
+} // namespace GE::Scene
@@ -0,0 +1,99 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2024, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <genesis/core/export.h>
+#include <genesis/core/memory.h>
+#include <genesis/scene/entity.h>
+
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace GE::Assets {
+class PrefabResource;
+class Registry;
+} // namespace GE::Assets
+
+namespace GE::Scene {
+
+class EntityNode;
+class Scene;
+
+// An entity subtree baked into packed per-component arrays. Instancing bulk inserts the arrays
+// and remaps the tree links, so all instances share the meshes, textures and pipelines of their
+// sprites and materials until an instance replaces them.
+class GE_API Prefab
+{
+public:
+    explicit Prefab(const Scene& scene);
+    // Bakes the subtree of the entity without its siblings
+    explicit Prefab(const Entity& root);
+    ~Prefab();
+
+    Prefab(const Prefab& other) = delete;
+    Prefab& operator=(const Prefab& other) = delete;
+
+    static Scoped<Prefab> create(const Assets::PrefabResource& resource, Assets::Registry* assets);
+
+    // Instances are appended after the last child of the parent or after the scene tail, the
+    // result contains the root entities of all instances
+    std::vector<Entity> instantiate(Scene* scene, uint32_t count = 1,
+                                    const Entity& parent = {}) const;
+
+    uint32_t entityCount() const { return static_cast<uint32_t>(m_links.size()); }
+
+private:
+    class IComponents;
+    template<typename T>
+    class Components;
+
+    static constexpr uint32_t NONE{std::numeric_limits<uint32_t>::max()};
+
+    struct link_t {
+        uint32_t prev{NONE};
+        uint32_t next{NONE};
+        uint32_t child{NONE};
+        uint32_t parent{NONE};
+    };
+
+    void bake(const EntityNode& first, bool with_siblings);
+    void insertNodes(Scene* scene, std::span<const Entity::NativeHandle> handles) const;
+
+    std::vector<link_t>              m_links;
+    std::vector<uint32_t>            m_roots;
+    std::vector<Scoped<IComponents>> m_components;
+};
+
+} // namespace GE::Scene
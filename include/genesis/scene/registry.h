@@ -32,12 +32,15 @@
 
 #pragma once
 
+#include <genesis/core/asserts.h>
 #include <genesis/core/export.h>
 #include <genesis/scene/entity.h>
 
 #include <entt/entity/registry.hpp>
 
 #include <functional>
+#include <span>
+#include <vector>
 
 namespace GE::Scene {
 
@@ -60,13 +63,24 @@ public:
     Registry& operator=(Registry&& other) noexcept;
 
     Entity create();
-    Entity entity(EntityHandle entity_handle);
+    Entity entity(EntityHandle entity_handle) const;
+    bool isValid(EntityHandle entity_handle) const;
     void destroy(const Entity& entity);
     void destroy(EntityHandle entity_handle);
     void clear();
 
     size_t size() const;
 
+    // Bulk creation for instancing, the entities are created without any components
+    std::vector<EntityHandle> createMany(size_t count);
+    // Bulk destruction walks each storage once instead of once per entity
+    void destroyMany(std::span<const EntityHandle> entities);
+
+    template<typename T>
+    void insert(std::span<const EntityHandle> entities, std::span<const T> components);
+    template<typename T>
+    void remove(std::span<const EntityHandle> entities);
+
     template<typename... Args>
     void eachEntityWith(const ForeachCallback& callback);
     void eachEntity(const ForeachCallback& callback);
@@ -78,7 +92,23 @@ public:
     template<typename... Args>
     Entity firstEntityWith() const;
 
+    // Storages are created lazily by entt, which isn't safe while other threads read them
+    template<typename... Args>
+    void prepareStorage();
+
+    // The observer receives 'onComponentChanged(EntityHandle, const T&)' when a component is added
+    // or patched and 'onComponentRemoved(EntityHandle)' when it's removed
+    template<typename T, typename Observer>
+    void observe(Observer* observer);
+    template<typename T, typename Observer>
+    void unobserve(Observer* observer);
+
 private:
+    template<typename T, typename Observer>
+    static void notifyChanged(Observer& observer, entt::registry& registry, EntityHandle entity);
+    template<typename T, typename Observer>
+    static void notifyRemoved(Observer& observer, entt::registry& registry, EntityHandle entity);
+
     Entity toEntity(EntityHandle entity) const;
 
     mutable entt::registry m_registry;
@@ -111,4 +141,53 @@ Entity Registry::firstEntityWith() const
     return {};
 }
 
+template<typename T>
+void Registry::insert(std::span<const EntityHandle> entities, std::span<const T> components)
+{
+    GE_CORE_ASSERT(entities.size() == components.size(), "Each entity needs one component");
+    m_registry.insert<T>(entities.begin(), entities.end(), components.begin());
+}
+
+template<typename T>
+void Registry::remove(std::span<const EntityHandle> entities)
+{
+    m_registry.remove<T>(entities.begin(), entities.end());
+}
+
+template<typename... Args>
+void Registry::prepareStorage()
+{
+    (m_registry.storage<Args>(), ...);
+}
+
+template<typename T, typename Observer>
+void Registry::observe(Observer* observer)
+{
+    m_registry.on_construct<T>().template connect<&notifyChanged<T, Observer>>(*observer);
+    m_registry.on_update<T>().template connect<&notifyChanged<T, Observer>>(*observer);
+    m_registry.on_destroy<T>().template connect<&notifyRemoved<T, Observer>>(*observer);
+}
+
+template<typename T, typename Observer>
+void Registry::unobserve(Observer* observer)
+{
+    m_registry.on_construct<T>().disconnect(observer);
+    m_registry.on_update<T>().disconnect(observer);
+    m_registry.on_destroy<T>().disconnect(observer);
+}
+
+template<typename T, typename Observer>
+void Registry::notifyChanged(Observer& observer, entt::registry& registry, EntityHandle entity)
+{
+    observer.onComponentChanged(entity, registry.get<T>(entity));
+}
+
+template<typename T, typename Observer>
+void Registry::notifyRemoved(Observer& observer,
+                             [[maybe_unused]] entt::registry& registry,
+                             EntityHandle                     entity)
+{
+    observer.onComponentRemoved(entity);
+}
+
 } // namespace GE::Scene
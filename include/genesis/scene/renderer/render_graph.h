@@ -0,0 +1,123 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2024, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <genesis/core/export.h>
+#include <genesis/core/memory.h>
+#include <genesis/graphics/framebuffer.h>
+#include <genesis/graphics/renderer.h>
+
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace GE::Scene {
+
+class GE_API RenderGraph
+{
+public:
+    using ResourceID = uint32_t;
+    using Execute = std::function<void(GE::Renderer* renderer, RenderGraph* graph)>;
+
+    ResourceID createTarget(std::string name, const Framebuffer::config_t& config);
+    ResourceID importTarget(std::string name, GE::Renderer* renderer);
+    void setTargetSize(ResourceID target, const Vec2& size);
+
+    void addPass(std::string             name,
+                 ResourceID              target,
+                 std::vector<ResourceID> reads,
+                 Renderer::ClearMode     clear_mode,
+                 Execute                 execute);
+
+    bool compile();
+    void execute();
+
+    Framebuffer* framebuffer(ResourceID target);
+    GE::Renderer* renderer(ResourceID target);
+
+    std::vector<std::string_view> executionOrder() const;
+    std::optional<uint32_t> physicalTarget(ResourceID target) const;
+    size_t physicalTargetCount() const { return m_physical_targets.size(); }
+    size_t frameCount() const { return m_frames.size(); }
+
+private:
+    struct physical_target_t {
+        Framebuffer::config_t config;
+        Scoped<Framebuffer>   framebuffer;
+    };
+
+    struct resource_t {
+        std::string           name;
+        Framebuffer::config_t config;
+        GE::Renderer*         imported_renderer{nullptr};
+        uint32_t              physical{0};
+        bool                  is_used{false};
+    };
+
+    struct pass_t {
+        std::string             name;
+        ResourceID              target{0};
+        std::vector<ResourceID> reads;
+        Renderer::ClearMode     clear_mode{Renderer::CLEAR_ALL};
+        Execute                 execute;
+    };
+
+    // Consecutive passes rendered into the target within a single begin/end frame
+    struct frame_t {
+        ResourceID          target{0};
+        Renderer::ClearMode clear_mode{Renderer::CLEAR_ALL};
+        size_t              first{0};
+        size_t              end{0};
+    };
+
+    bool isImported(ResourceID target) const;
+    bool hasProducer(ResourceID target, uint32_t pass_index) const;
+    bool dependsOn(const pass_t& pass, const pass_t& other) const;
+    std::vector<bool> cullPasses() const;
+    void sortPasses(const std::vector<bool>& is_alive);
+    void groupFrames();
+    void assignPhysicalTargets();
+    void allocatePhysicalTargets();
+
+    std::vector<resource_t>        m_resources;
+    std::vector<pass_t>            m_passes;
+    std::vector<uint32_t>          m_order;
+    std::vector<frame_t>           m_frames;
+    std::vector<physical_target_t> m_physical_targets;
+    bool                           m_is_compiled{false};
+    bool                           m_is_allocated{false};
+};
+
+} // namespace GE::Scene
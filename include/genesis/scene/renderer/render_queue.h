@@ -0,0 +1,119 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2024, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <genesis/core/export.h>
+#include <genesis/math/types.h>
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace GE {
+class Mesh;
+class Pipeline;
+class Renderer;
+class Texture;
+} // namespace GE
+
+namespace GE::Scene {
+
+class GE_API RenderQueue
+{
+public:
+    enum class Pass : uint8_t
+    {
+        OPAQUE_ENTITIES = 0,
+        TRANSPARENT_ENTITIES = 1,
+    };
+
+    struct item_t {
+        Pipeline* pipeline{nullptr};
+        Texture*  texture{nullptr};
+        Mesh*     mesh{nullptr};
+        Mat4      mvp{1.0f};
+    };
+
+    void clear();
+    void push(Pass pass, const item_t& item);
+    void sort();
+    void submit(GE::Renderer* renderer, Pass pass) const;
+
+    template<typename Callback>
+    void forEach(Pass pass, Callback&& callback) const;
+
+    size_t size() const { return m_items.size(); }
+    bool isEmpty() const { return m_items.empty(); }
+
+    static uint64_t
+    makeKey(Pass pass, uint32_t pipeline_id, uint32_t texture_id, uint32_t mesh_id, float depth);
+
+    static constexpr uint32_t PASS_BITS{1};
+    static constexpr uint32_t PIPELINE_BITS{7};
+    static constexpr uint32_t TEXTURE_BITS{16};
+    static constexpr uint32_t MESH_BITS{16};
+    static constexpr uint32_t DEPTH_BITS{24};
+
+private:
+    struct sort_entry_t {
+        uint64_t key{0};
+        uint32_t index{0};
+    };
+
+    using IdMap = std::unordered_map<const void*, uint32_t>;
+
+    uint32_t resourceId(IdMap* ids, const void* resource, uint32_t bits);
+    std::pair<size_t, size_t> range(Pass pass) const;
+    void radixSort();
+
+    std::vector<item_t>       m_items;
+    std::vector<uint64_t>     m_keys;
+    std::vector<uint64_t>     m_cached_keys;
+    std::vector<sort_entry_t> m_order;
+    std::vector<sort_entry_t> m_scratch;
+    IdMap                     m_pipeline_ids;
+    IdMap                     m_texture_ids;
+    IdMap                     m_mesh_ids;
+};
+
+template<typename Callback>
+void RenderQueue::forEach(Pass pass, Callback&& callback) const
+{
+    auto [begin, end] = range(pass);
+
+    for (size_t i = begin; i < end; i++) {
+        callback(m_items[m_order[i].index]);
+    }
+}
+
+} // namespace GE::Scene
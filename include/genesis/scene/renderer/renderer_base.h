@@ -32,10 +32,16 @@
 
 #pragma once
 
+#include <genesis/assets/registry.h>
 #include <genesis/graphics/pipeline.h>
 #include <genesis/graphics/primitives_renderer.h>
 #include <genesis/scene/pipeline_library.h>
+#include <genesis/scene/entity.h>
 #include <genesis/scene/renderer/irenderer.h>
+#include <genesis/scene/renderer/render_queue.h>
+
+#include <unordered_set>
+#include <vector>
 
 namespace GE {
 class Mesh;
@@ -45,28 +51,39 @@ class Texture;
 
 namespace GE::Scene {
 
-class Entity;
 class ViewProjectionCamera;
 
 class RendererBase: public IRenderer
 {
 public:
-    RendererBase(GE::Renderer* renderer, const ViewProjectionCamera* camera);
+    RendererBase(GE::Renderer*               renderer,
+                 const Assets::Registry&     assets,
+                 const ViewProjectionCamera* camera);
 
 protected:
-    void renderEntity(GE::Renderer* renderer, Pipeline* pipeline, const Entity& entity);
+    // The spatial index is expected to be updated by the owner of the scene
+    void updateVisibleEntities(const Scene& scene);
+    void pushEntity(RenderQueue::Pass pass, Pipeline* pipeline, size_t visible_index);
 
-    void renderPhysics2DColliders(const Entity& entity);
-    void renderCircleCollider2D(const Entity& entity);
-    void renderBoxCollider2D(const Entity& entit);
+    void renderPhysics2DColliders(const Scene& scene);
+    void addCircleCollider2D(const Entity& entity, const Mat4& entity_transform);
+    void addBoxCollider2D(const Entity& entity, const Mat4& entity_transform);
 
-    bool
-    isValid(std::string_view entity_name, Pipeline* material, Texture* texture, Mesh* mesh) const;
+    bool isValid(const Entity& entity, Pipeline* material, Texture* texture, Mesh* mesh);
 
-    GE::Renderer*               m_renderer{nullptr};
-    PipelineLibrary             m_pipeline_library;
-    PrimitivesRenderer          m_primitives_renderer;
-    const ViewProjectionCamera* m_camera{nullptr};
+    GE::Renderer*                            m_renderer{nullptr};
+    const Assets::Registry*                  m_assets{nullptr};
+    PipelineLibrary                          m_pipeline_library;
+    PrimitivesRenderer                       m_primitives_renderer;
+    const ViewProjectionCamera*              m_camera{nullptr};
+    std::vector<Entity>                      m_visible_entities;
+    std::vector<Mat4>                        m_visible_transforms;
+    std::vector<Assets::TextureHandle>       m_visible_texture_handles;
+    std::vector<Assets::MeshHandle>          m_visible_mesh_handles;
+    std::vector<Texture*>                    m_visible_textures;
+    std::vector<Mesh*>                       m_visible_meshes;
+    RenderQueue                              m_render_queue;
+    std::unordered_set<Entity::NativeHandle> m_invalid_entities;
 };
 
 Mat4 parentTransform(const Entity& entity);
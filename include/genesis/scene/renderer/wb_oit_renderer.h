@@ -34,12 +34,9 @@
 
 #include <genesis/core/memory.h>
 #include <genesis/math/types.h>
+#include <genesis/scene/renderer/render_graph.h>
 #include <genesis/scene/renderer/renderer_base.h>
 
-namespace GE {
-class Framebuffer;
-} // namespace GE
-
 namespace GE::Assets {
 class Registry;
 } // namespace GE::Assets
@@ -61,20 +58,21 @@ public:
     static constexpr std::string_view TYPE = "Weighted-Blended OIT Scene Renderer";
 
 private:
-    void recreateWbOitFramebuffer(const Vec2& size);
+    void buildRenderGraph();
     void createOpaqueColorPipeline(GE::Renderer* renderer, const Assets::Registry& assets);
     void createAccumulationPipeline(GE::Renderer* renderer, const Assets::Registry& assets);
     void createComposingPipeline(GE::Renderer* renderer, const Assets::Registry& assets);
 
-    void renderOpaqueEntities(GE::Renderer* renderer, const Scene& scene);
-    void renderTransparentEntities(GE::Renderer* renderer, const Scene& scene);
+    void buildRenderQueue();
     void renderPhysicsColliders(const Scene& scene);
-    void composeScene(GE::Renderer* renderer);
+    void composeScene(GE::Renderer* renderer, const Framebuffer& wb_oit_fbo);
 
-    Scoped<Framebuffer> m_wb_oit_fbo;
-    Shared<Pipeline>    m_color_pipeline;
-    Shared<Pipeline>    m_accumulation_pipeline;
-    Shared<Pipeline>    m_composing_pipeline;
+    RenderGraph             m_render_graph;
+    RenderGraph::ResourceID m_wb_oit_target{0};
+    const Scene*            m_scene{nullptr};
+    Shared<Pipeline>        m_color_pipeline;
+    Shared<Pipeline>        m_accumulation_pipeline;
+    Shared<Pipeline>        m_composing_pipeline;
 };
 
 } // namespace GE::Scene
@@ -33,9 +33,17 @@
 #pragma once
 
 #include <genesis/core/export.h>
+#include <genesis/scene/name_index.h>
 #include <genesis/scene/registry.h>
+#include <genesis/scene/spatial_index.h>
 
+#include <span>
 #include <string>
+#include <vector>
+
+namespace GE::Assets {
+class Registry;
+} // namespace GE::Assets
 
 namespace GE::Scene {
 
@@ -47,7 +55,7 @@ public:
     using ForeachCallback = Registry::ForeachCallback;
     using ForeachConstCallback = Registry::ForeachConstCallback;
 
-    Scene() = default;
+    Scene();
     ~Scene() = default;
 
     Scene(const Scene& other) = delete;
@@ -57,11 +65,31 @@ public:
     Scene& operator=(Scene&& other) noexcept;
 
     Entity createEntity(std::string_view name = {});
-    Entity entity(Entity::NativeHandle entity_handle);
+    Entity entity(Entity::NativeHandle entity_handle) const;
+    Entity findEntity(std::string_view name) const;
+    bool isValid(Entity::NativeHandle entity_handle) const;
     void destroyEntity(const Entity& entity);
     void destroyEntity(Entity::NativeHandle entity_handle);
+    // Like destroyEntity(), the entities aren't unlinked from the entity tree
+    void destroyEntities(std::span<const Entity::NativeHandle> entities);
     void clear();
 
+    // Copies the entity with its children into the destination scene, the copy is appended to the
+    // children of the parent or after the destination tail
+    Entity cloneEntity(const Entity& entity, Scene* destination, const Entity& parent = {}) const;
+    // Clones the entity into the same scene, next to the children of its parent
+    Entity duplicateEntity(const Entity& entity);
+
+    // Entities are created without components and aren't linked into the entity tree, the caller
+    // is responsible for adding the tag, the transform and the node components
+    std::vector<Entity::NativeHandle> createEntities(size_t count);
+
+    template<typename T>
+    void insertComponents(std::span<const Entity::NativeHandle> entities,
+                          std::span<const T>                    components);
+    template<typename T>
+    void removeComponents(std::span<const Entity::NativeHandle> entities);
+
     Entity headEntity() const;
     Entity tailEnity() const;
 
@@ -71,6 +99,12 @@ public:
     const std::string& name() const { return m_name; }
     void setName(std::string_view name) { m_name = name; }
 
+    const SpatialIndex& spatialIndex() const { return m_spatial_index; }
+    // Called once per frame by the owner of the scene, before the index is queried
+    void updateSpatialIndex(const Assets::Registry& assets);
+
+    const NameIndex& nameIndex() const { return m_name_index; }
+
     template<typename... Args>
     void forEach(const ForeachCallback& callback);
     void forEachEntity(const ForeachCallback& callback);
@@ -79,12 +113,21 @@ public:
     void forEach(const ForeachConstCallback& callback) const;
     void forEachEntity(const ForeachConstCallback& callback) const;
 
+    template<typename... Args>
+    void prepareStorage();
+
     static constexpr uint32_t SERIALIZATION_VERSION{1};
 
 private:
-    std::string m_name;
-    Registry    m_registry;
-    Entity      m_main_camera;
+    void observeIndices(Registry* registry);
+    void reobserveIndices(Scene* moved_from);
+
+    // The indices are declared first, so they outlive the registry notifying them
+    std::string  m_name;
+    NameIndex    m_name_index;
+    SpatialIndex m_spatial_index;
+    Registry     m_registry;
+    Entity       m_main_camera;
 };
 
 template<typename... Args>
@@ -99,4 +142,23 @@ void Scene::forEach(const Scene::ForeachConstCallback& callback) const
     m_registry.eachEntityWith<Args...>(callback);
 }
 
+template<typename T>
+void Scene::insertComponents(std::span<const Entity::NativeHandle> entities,
+                             std::span<const T>                    components)
+{
+    m_registry.insert<T>(entities, components);
+}
+
+template<typename T>
+void Scene::removeComponents(std::span<const Entity::NativeHandle> entities)
+{
+    m_registry.remove<T>(entities);
+}
+
+template<typename... Args>
+void Scene::prepareStorage()
+{
+    m_registry.prepareStorage<Args...>();
+}
+
 } // namespace GE::Scene
@@ -33,37 +33,77 @@
 #pragma once
 
 #include <genesis/core/export.h>
+#include <genesis/core/timestamp.h>
+#include <genesis/scene/entity.h>
 #include <genesis/scene/scene.h>
 
+#include <yaml-cpp/node/node.h>
+
+#include <future>
+#include <string>
+#include <vector>
+
 namespace GE::Assets {
 class Registry;
 } // namespace GE::Assets
 
-namespace YAML {
-class Node;
-} // namespace YAML
-
 namespace GE::Scene {
 
-class Entity;
-
 class GE_API SceneDeserializer
 {
 public:
+    enum class Status : uint8_t
+    {
+        IDLE,
+        PARSING,
+        LOADING,
+        DONE,
+        FAILED,
+    };
+
+    // Without an assets registry sprites and materials keep only their resource IDs, so a scene
+    // can be loaded without creating GPU resources
     SceneDeserializer(Scene* scene, Assets::Registry* assets);
 
     bool deserialize(const std::string& config_filepath);
+    bool deserialize(const YAML::Node& node);
+
+    // Incremental loading: the file is parsed on a background thread, then every update()
+    // creates entities until the time budget is spent. The target scene is replaced only when
+    // the whole scene has been loaded.
+    void start(const std::string& config_filepath);
+    Status update(Timestamp budget);
+
+    Status status() const { return m_status; }
+    const std::string& filepath() const { return m_filepath; }
+    uint32_t loadedEntityCount() const { return m_loaded_entity_count; }
 
 private:
-    Entity loadEntities(Scene* scene, const YAML::Node& node);
-    Entity loadEntity(Scene* scene, const YAML::Node& node);
+    struct entity_list_t {
+        YAML::Node nodes;
+        size_t     index{0};
+        Entity     parent;
+        Entity     last_entity;
+    };
+
+    bool beginLoading(const YAML::Node& node);
+    void loadNextEntity();
+    void finishLoading();
+    void fail(std::string_view error);
+
     bool loadComponent(Entity* entity, const YAML::Node& node);
-    void loadMaterialComponent(Entity* entity, const YAML::Node& node);
-    void loadSpriteComponent(Entity* entity, const YAML::Node& node);
 
-    Scene             m_scene_buffer;
-    Scene*            m_scene{nullptr};
-    Assets::Registry* m_assets{nullptr};
+    template<typename T>
+    void loadComponent(Entity* entity, const YAML::Node& node);
+
+    Scene                      m_scene_buffer;
+    Scene*                     m_scene{nullptr};
+    Assets::Registry*          m_assets{nullptr};
+    std::string                m_filepath;
+    std::future<YAML::Node>    m_parsed_node;
+    std::vector<entity_list_t> m_entity_lists;
+    uint32_t                   m_loaded_entity_count{0};
+    Status                     m_status{Status::IDLE};
 };
 
 } // namespace GE::Scene
@@ -0,0 +1,212 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2024, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <genesis/core/export.h>
+#include <genesis/math/aabb.h>
+#include <genesis/scene/entity.h>
+
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace GE::Assets {
+class Registry;
+} // namespace GE::Assets
+
+namespace GE::Scene {
+
+class EntityNode;
+class Scene;
+
+// Caches the world transforms of the scene entities and the bounds of their sprites. Changes are
+// tracked through the registry signals, so transforms, sprites and the hierarchy have to be changed
+// with Entity::patch() to be reindexed.
+class GE_API SpatialIndex
+{
+public:
+    using NativeHandle = Entity::NativeHandle;
+
+    // Refreshes the subtrees of the entities changed since the last update
+    void update(const Scene& scene, const Assets::Registry& assets);
+    void clear();
+
+    void insert(NativeHandle entity, const aabb_t& bounds);
+    void insertUnbounded(NativeHandle entity);
+    void move(NativeHandle entity, const aabb_t& bounds);
+    void remove(NativeHandle entity);
+
+    bool contains(NativeHandle entity) const;
+    aabb_t bounds(NativeHandle entity) const;
+    // As of the last update, entities unknown to the index have the identity transform
+    Mat4 worldTransform(NativeHandle entity) const;
+    size_t size() const { return m_leaf_count + m_unbounded.size(); }
+    int32_t height() const;
+
+    template<typename Callback>
+    void query(const aabb_t& bounds, Callback&& callback) const;
+    template<typename Callback>
+    void queryPoint(const Vec2& point, Callback&& callback) const;
+    template<typename Callback>
+    void queryFrustum(const frustum_t& frustum, Callback&& callback) const;
+    template<typename Callback>
+    void raycast(const Vec3& origin, const Vec3& direction, Callback&& callback) const;
+
+    template<typename T>
+    void onComponentChanged(NativeHandle entity, [[maybe_unused]] const T& component)
+    {
+        m_dirty.insert(entity);
+    }
+
+    void onComponentRemoved(NativeHandle entity) { m_dirty.insert(entity); }
+
+    static constexpr float AABB_MARGIN{0.1f};
+
+private:
+    static constexpr int32_t NULL_NODE{-1};
+
+    struct node_t {
+        aabb_t       bounds;
+        aabb_t       tight_bounds;
+        NativeHandle entity{Entity::NULL_ID};
+        int32_t      parent{NULL_NODE};
+        int32_t      left{NULL_NODE};
+        int32_t      right{NULL_NODE};
+        int32_t      height{0};
+
+        bool isLeaf() const { return left == NULL_NODE; }
+    };
+
+    struct proxy_t {
+        Mat4    world_transform{1.0f};
+        int32_t node{NULL_NODE};
+    };
+
+    void updateSubtree(const EntityNode&       root,
+                       const Mat4&             parent_transform,
+                       const Assets::Registry& assets);
+    void updateEntity(const Entity&           entity,
+                      const Mat4&             world_transform,
+                      const Assets::Registry& assets);
+    bool hasDirtyAncestor(const EntityNode& node) const;
+    Mat4 parentWorldTransform(const EntityNode& node) const;
+    void detachLeaf(proxy_t* proxy);
+
+    int32_t allocateNode();
+    void freeNode(int32_t node);
+
+    void insertLeaf(int32_t leaf);
+    void removeLeaf(int32_t leaf);
+    int32_t balance(int32_t node);
+    int32_t findSibling(const aabb_t& bounds) const;
+    void refitAncestors(int32_t node);
+
+    template<typename Predicate, typename Callback>
+    void traverse(Predicate&& overlaps, Callback&& callback) const;
+
+    std::vector<node_t>                       m_nodes;
+    std::vector<int32_t>                      m_free_nodes;
+    std::unordered_map<NativeHandle, proxy_t> m_proxies;
+    std::unordered_set<NativeHandle>          m_unbounded;
+    std::unordered_set<NativeHandle>          m_dirty;
+    int32_t                                   m_root{NULL_NODE};
+    size_t                                    m_leaf_count{0};
+};
+
+template<typename Predicate, typename Callback>
+void SpatialIndex::traverse(Predicate&& overlaps, Callback&& callback) const
+{
+    if (m_root == NULL_NODE) {
+        return;
+    }
+
+    std::vector<int32_t> stack;
+    stack.reserve(64);
+    stack.push_back(m_root);
+
+    while (!stack.empty()) {
+        const auto& node = m_nodes[stack.back()];
+        stack.pop_back();
+
+        if (!overlaps(node.bounds)) {
+            continue;
+        }
+
+        if (!node.isLeaf()) {
+            stack.push_back(node.left);
+            stack.push_back(node.right);
+        } else if (overlaps(node.tight_bounds)) {
+            callback(node.entity, node.tight_bounds);
+        }
+    }
+}
+
+template<typename Callback>
+void SpatialIndex::query(const aabb_t& bounds, Callback&& callback) const
+{
+    traverse([&bounds](const aabb_t& node_bounds) { return bounds.overlaps2D(node_bounds); },
+             [&callback](NativeHandle entity, const aabb_t&) { callback(entity); });
+}
+
+template<typename Callback>
+void SpatialIndex::queryPoint(const Vec2& point, Callback&& callback) const
+{
+    aabb_t bounds{Vec3{point, 0.0f}, Vec3{point, 0.0f}};
+    query(bounds, std::forward<Callback>(callback));
+}
+
+template<typename Callback>
+void SpatialIndex::queryFrustum(const frustum_t& frustum, Callback&& callback) const
+{
+    traverse([&frustum](const aabb_t& node_bounds) { return frustum.intersects(node_bounds); },
+             [&callback](NativeHandle entity, const aabb_t&) { callback(entity); });
+
+    // Entities without bounds can't be culled, so they are always visible
+    for (auto entity : m_unbounded) {
+        callback(entity);
+    }
+}
+
+template<typename Callback>
+void SpatialIndex::raycast(const Vec3& origin, const Vec3& direction, Callback&& callback) const
+{
+    traverse(
+        [&origin, &direction](const aabb_t& node_bounds) {
+            return rayIntersection(node_bounds, origin, direction) >= 0.0f;
+        },
+        [&origin, &direction, &callback](NativeHandle entity, const aabb_t& bounds) {
+            callback(entity, rayIntersection(bounds, origin, direction));
+        });
+}
+
+} // namespace GE::Scene
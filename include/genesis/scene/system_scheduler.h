@@ -0,0 +1,175 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2024, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <genesis/core/export.h>
+#include <genesis/core/job_system.h>
+#include <genesis/core/timestamp.h>
+#include <genesis/scene/command_buffer.h>
+#include <genesis/scene/scene.h>
+
+#include <entt/core/type_info.hpp>
+
+#include <functional>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace GE::Scene {
+
+class GE_API ComponentAccess
+{
+public:
+    template<typename... Components>
+    ComponentAccess& read();
+    template<typename... Components>
+    ComponentAccess& write();
+
+    bool conflictsWith(const ComponentAccess& other) const;
+    void prepareStorage(Scene* scene) const;
+
+private:
+    struct component_t {
+        entt::id_type id{0};
+        void (*prepare_storage)(Scene* scene){nullptr};
+    };
+
+    template<typename T>
+    static component_t component();
+
+    std::vector<component_t> m_reads;
+    std::vector<component_t> m_writes;
+};
+
+struct system_context_t {
+    Scene*                   scene{nullptr};
+    JobSystem*               jobs{nullptr};
+    std::span<CommandBuffer> commands;
+    Timestamp                ts;
+    uint32_t                 worker_index{0};
+
+    // Structural changes are recorded per worker and applied at the next sync point
+    CommandBuffer& workerCommands(uint32_t index) const { return commands[index]; }
+    CommandBuffer& systemCommands() const { return commands[worker_index]; }
+};
+
+class GE_API SystemScheduler: public NonCopyable
+{
+public:
+    using System = std::function<void(const system_context_t& ctx)>;
+    using ChunkCallback = std::function<void(Entity& entity, uint32_t worker_index)>;
+
+    explicit SystemScheduler(uint32_t worker_count);
+
+    // Systems without conflicting component access run concurrently, the conflicting ones run
+    // in the order they have been added
+    void addSystem(std::string name, ComponentAccess access, System system);
+    // Systems added after a sync point see the structural changes of the systems before it
+    void addSyncPoint();
+
+    void run(Scene* scene, Timestamp ts);
+
+    // Each batch is a set of system names, which run concurrently
+    std::vector<std::vector<std::string>> batches();
+
+    template<typename... Components>
+    static void parallelForEach(const system_context_t& ctx,
+                                uint32_t                min_range,
+                                const ChunkCallback&    callback);
+
+private:
+    struct system_t {
+        std::string     name;
+        ComponentAccess access;
+        System          system;
+        uint32_t        phase{0};
+    };
+
+    struct batch_t {
+        std::vector<uint32_t> systems;
+        bool                  is_sync_point{false};
+    };
+
+    void buildBatches();
+    void runBatch(const batch_t& batch, Scene* scene, Timestamp ts);
+    void applyCommands(Scene* scene);
+
+    JobSystem                  m_jobs;
+    std::vector<CommandBuffer> m_commands;
+    std::vector<system_t>      m_systems;
+    std::vector<batch_t>       m_batches;
+    uint32_t                   m_phase{0};
+    bool                       m_is_dirty{false};
+};
+
+template<typename... Components>
+ComponentAccess& ComponentAccess::read()
+{
+    (m_reads.push_back(component<Components>()), ...);
+    return *this;
+}
+
+template<typename... Components>
+ComponentAccess& ComponentAccess::write()
+{
+    (m_writes.push_back(component<Components>()), ...);
+    return *this;
+}
+
+template<typename T>
+ComponentAccess::component_t ComponentAccess::component()
+{
+    return {entt::type_hash<T>::value(), [](Scene* scene) { scene->prepareStorage<T>(); }};
+}
+
+template<typename... Components>
+void SystemScheduler::parallelForEach(const system_context_t& ctx,
+                                      uint32_t                min_range,
+                                      const ChunkCallback&    callback)
+{
+    std::vector<Entity> entities;
+    ctx.scene->forEach<Components...>([&entities](Entity& entity) { entities.push_back(entity); });
+
+    JobSystem::Counter counter;
+    ctx.jobs->parallelFor(
+        static_cast<uint32_t>(entities.size()), min_range,
+        [&entities, &callback](uint32_t begin, uint32_t end, uint32_t worker_index) {
+            for (uint32_t i{begin}; i < end; i++) {
+                callback(entities[i], worker_index);
+            }
+        },
+        &counter);
+    ctx.jobs->wait(counter);
+}
+
+} // namespace GE::Scene
@@ -38,12 +38,12 @@ namespace GE::Assets {
 namespace {
 
 template<typename T>
-void appendIds(std::vector<ResourceID>*                          resource_ids,
-               const std::unordered_map<std::string, Shared<T>>& resources)
+void appendIds(std::vector<ResourceID>*                         resource_ids,
+               const std::unordered_map<ResourceID, Shared<T>>& resources)
 {
     resource_ids->reserve(resource_ids->size() + resources.size());
     std::ranges::transform(resources, std::back_inserter(*resource_ids),
-                           [](const auto& item) { return item.second->id(); });
+                           [](const auto& item) { return item.first; });
 }
 
 } // namespace
@@ -54,6 +54,7 @@ Package::Package(Package&& other) noexcept
     , m_pipelines{std::move(other.m_pipelines)}
     , m_meshes{std::move(other.m_meshes)}
     , m_textures{std::move(other.m_textures)}
+    , m_prefabs{std::move(other.m_prefabs)}
 {}
 
 Package& Package::operator=(Package&& other) noexcept
@@ -64,6 +65,7 @@ Package& Package::operator=(Package&& other) noexcept
         m_pipelines = std::move(other.m_pipelines);
         m_meshes = std::move(other.m_meshes);
         m_textures = std::move(other.m_textures);
+        m_prefabs = std::move(other.m_prefabs);
     }
 
     return *this;
@@ -71,9 +73,10 @@ Package& Package::operator=(Package&& other) noexcept
 
 void Package::removeResource(const ResourceID& id)
 {
-    m_pipelines.erase(id.name());
-    m_meshes.erase(id.name());
-    m_textures.erase(id.name());
+    m_pipelines.erase(id);
+    m_meshes.erase(id);
+    m_textures.erase(id);
+    m_prefabs.erase(id);
 }
 
 std::vector<ResourceID> Package::allResourceIDs() const
@@ -82,6 +85,7 @@ std::vector<ResourceID> Package::allResourceIDs() const
     appendIds(&resource_ids, m_pipelines);
     appendIds(&resource_ids, m_meshes);
     appendIds(&resource_ids, m_textures);
+    appendIds(&resource_ids, m_prefabs);
 
     return resource_ids;
 }
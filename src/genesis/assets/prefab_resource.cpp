@@ -0,0 +1,81 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2024, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "prefab_resource.h"
+#include "assets_exception.h"
+
+#include "genesis/core/format.h"
+#include "genesis/core/log.h"
+
+#include <yaml-cpp/yaml.h>
+
+namespace GE::Assets {
+namespace {
+
+YAML::Node loadDescription(const std::string& filepath)
+{
+    YAML::Node description;
+
+    try {
+        description = YAML::LoadFile(filepath);
+    } catch (const std::exception& e) {
+        throw Assets::Exception{
+            GE_FMTSTR("Failed to parse a prefab from the file '{}': '{}'", filepath, e.what())};
+    }
+
+    if (!description["scene"]["entities"].IsSequence()) {
+        throw Assets::Exception{GE_FMTSTR("The file '{}' doesn't describe entities", filepath)};
+    }
+
+    return description;
+}
+
+} // namespace
+
+PrefabResource::PrefabResource(const std::string& package, const config_t& config)
+    : ResourceBase{{package, GROUP, config.name}}
+    , m_filepath{config.filepath}
+    , m_description{loadDescription(m_filepath)}
+{}
+
+Shared<PrefabResource> PrefabResource::Factory::create(const std::string& package,
+                                                       const config_t&    config)
+{
+    try {
+        return Shared<PrefabResource>{new PrefabResource{package, config}};
+    } catch (const GE::Exception& e) {
+        GE_CORE_ERR("Failed to create a prefab resource: {}", e.what());
+        return nullptr;
+    }
+}
+
+} // namespace GE::Assets
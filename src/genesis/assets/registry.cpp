@@ -35,6 +35,43 @@
 #include <algorithm>
 
 namespace GE::Assets {
+namespace {
+
+template<typename T>
+using HandleMap = std::unordered_map<ResourceID, Handle<T>>;
+
+template<typename Resource, typename T, typename Accessor>
+Handle<T> findOrInsertHandle(const Registry& registry, HandlePool<T>* pool, HandleMap<T>* handles,
+                             const ResourceID& id, Accessor&& object)
+{
+    if (auto it = handles->find(id); it != handles->end() && pool->isAlive(it->second)) {
+        return it->second;
+    }
+
+    auto resource = registry.get<Resource>(id);
+    if (resource == nullptr) {
+        return {};
+    }
+
+    auto handle = pool->insert(object(*resource));
+    (*handles)[id] = handle;
+    return handle;
+}
+
+template<typename T, typename Predicate>
+void releaseHandles(HandlePool<T>* pool, HandleMap<T>* handles, Predicate&& predicate)
+{
+    std::erase_if(*handles, [pool, &predicate](const auto& item) {
+        if (!predicate(item.first)) {
+            return false;
+        }
+
+        pool->release(item.second);
+        return true;
+    });
+}
+
+} // namespace
 
 Registry::Registry() = default;
 
@@ -42,12 +79,20 @@ Registry::~Registry() = default;
 
 Registry::Registry(Registry&& other) noexcept
     : m_packages{std::move(other.m_packages)}
+    , m_textures{std::move(other.m_textures)}
+    , m_meshes{std::move(other.m_meshes)}
+    , m_texture_handles{std::move(other.m_texture_handles)}
+    , m_mesh_handles{std::move(other.m_mesh_handles)}
 {}
 
 Registry& Registry::operator=(Registry&& other) noexcept
 {
     if (this != &other) {
         m_packages = std::move(other.m_packages);
+        m_textures = std::move(other.m_textures);
+        m_meshes = std::move(other.m_meshes);
+        m_texture_handles = std::move(other.m_texture_handles);
+        m_mesh_handles = std::move(other.m_mesh_handles);
     }
 
     return *this;
@@ -55,30 +100,39 @@ Registry& Registry::operator=(Registry&& other) noexcept
 
 Package* Registry::emplacePackage(const std::string& name, const std::string& filepath)
 {
-    return &m_packages.emplace(name, Package{name, filepath}).first->second;
+    return &m_packages.emplace(StringTable::intern(name), Package{name, filepath}).first->second;
 }
 
 void Registry::insertPackage(Package&& package)
 {
-    auto name = package.name();
-    m_packages.insert({std::move(name), std::move(package)});
+    auto id = StringTable::intern(package.name());
+    m_packages.insert({id, std::move(package)});
 }
 
 void Registry::removePackage(const std::string& name)
 {
-    m_packages.erase(name);
+    auto package_id = StringTable::intern(name);
+    auto in_package = [package_id](const ResourceID& id) { return id.packageID() == package_id; };
+    releaseHandles(&m_textures, &m_texture_handles, in_package);
+    releaseHandles(&m_meshes, &m_mesh_handles, in_package);
+
+    m_packages.erase(package_id);
 }
 
 void Registry::removeResource(const ResourceID& id)
 {
-    if (auto it = m_packages.find(id.package()); it != m_packages.end()) {
+    auto is_resource = [&id](const ResourceID& other) { return other == id; };
+    releaseHandles(&m_textures, &m_texture_handles, is_resource);
+    releaseHandles(&m_meshes, &m_mesh_handles, is_resource);
+
+    if (auto it = m_packages.find(id.packageID()); it != m_packages.end()) {
         it->second.removeResource(id);
     }
 }
 
 Package* Registry::package(const std::string& name)
 {
-    if (auto it = m_packages.find(name); it != m_packages.end()) {
+    if (auto it = m_packages.find(StringTable::intern(name)); it != m_packages.end()) {
         return &it->second;
     }
 
@@ -87,7 +141,7 @@ Package* Registry::package(const std::string& name)
 
 const Package* Registry::package(const std::string& name) const
 {
-    if (auto it = m_packages.find(name); it != m_packages.end()) {
+    if (auto it = m_packages.find(StringTable::intern(name)); it != m_packages.end()) {
         return &it->second;
     }
 
@@ -106,12 +160,34 @@ std::vector<ResourceID> Registry::allResourceIDs()
 {
     std::vector<ResourceID> all_resource_ids;
 
-    for (const auto& [package_name, package] : m_packages) {
+    for (const auto& [package_id, package] : m_packages) {
         auto resource_ids = package.allResourceIDs();
-        std::ranges::copy(all_resource_ids, std::back_inserter(all_resource_ids));
+        std::ranges::copy(resource_ids, std::back_inserter(all_resource_ids));
     }
 
     return all_resource_ids;
 }
 
+TextureHandle Registry::textureHandle(const ResourceID& id)
+{
+    auto texture = [](const TextureResource& resource) { return resource.texture(); };
+    return findOrInsertHandle<TextureResource>(*this, &m_textures, &m_texture_handles, id, texture);
+}
+
+MeshHandle Registry::meshHandle(const ResourceID& id)
+{
+    auto mesh = [](const MeshResource& resource) { return resource.mesh(); };
+    return findOrInsertHandle<MeshResource>(*this, &m_meshes, &m_mesh_handles, id, mesh);
+}
+
+void Registry::resolve(std::span<const TextureHandle> handles, std::span<Texture*> textures) const
+{
+    m_textures.get(handles, textures);
+}
+
+void Registry::resolve(std::span<const MeshHandle> handles, std::span<Mesh*> meshes) const
+{
+    m_meshes.get(handles, meshes);
+}
+
 } // namespace GE::Assets
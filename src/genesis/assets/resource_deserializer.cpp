@@ -33,6 +33,7 @@
 #include "resource_deserializer.h"
 #include "mesh_resource.h"
 #include "pipeline_resource.h"
+#include "prefab_resource.h"
 #include "registry.h"
 #include "texture_resource.h"
 #include "yaml_convert.h"
@@ -70,6 +71,7 @@ void ResourceDeserializer::deserializePackage(const std::string& package_filepat
     deserializeMeshes(&package, resources_node);
     deserializePipelines(&package, resources_node);
     deserializeTextures(&package, resources_node);
+    deserializePrefabs(&package, resources_node);
 
     m_assets->insertPackage(std::move(package));
 }
@@ -95,6 +97,13 @@ void ResourceDeserializer::deserializeTextures(Package* package, const YAML::Nod
     }
 }
 
+void ResourceDeserializer::deserializePrefabs(Package* package, const YAML::Node& package_node)
+{
+    for (const auto& prefab_node : package_node[GE::toString(Group::PREFABS)]) {
+        deserializeResource<PrefabResource>(package, prefab_node);
+    }
+}
+
 template<typename T>
 void ResourceDeserializer::deserializeResource(Package* package, const YAML::Node& resource_node)
 {
@@ -33,6 +33,7 @@
 #include "resource_serializer.h"
 #include "genesis/core/asserts.h"
 #include "pipeline_resource.h"
+#include "prefab_resource.h"
 #include "registry.h"
 #include "texture_resource.h"
 #include "yaml_convert.h"
@@ -110,6 +111,10 @@ YAML::Node ResourceSerializer::serializePackage(const Package& package)
         resources_node[GE::toString(Group::TEXTURES)].push_back(YAML::Node{*texture});
     }
 
+    for (const auto& prefab : package.getAllOf<PrefabResource>()) {
+        resources_node[GE::toString(Group::PREFABS)].push_back(YAML::Node{*prefab});
+    }
+
     return package_node;
 }
 
@@ -0,0 +1,268 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2024, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "job_system.h"
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+namespace GE {
+namespace {
+
+constexpr uint32_t CALLER_WORKER_INDEX{0};
+
+struct worker_context_t {
+    const JobSystem* system{nullptr};
+    uint32_t         index{CALLER_WORKER_INDEX};
+};
+
+thread_local worker_context_t current_worker;
+
+} // namespace
+
+JobSystem::JobSystem(uint32_t worker_count)
+    : m_queues(std::max(worker_count, 1U))
+{
+    for (uint32_t i{1}; i < workerCount(); i++) {
+        m_threads.emplace_back([this, i] { workerLoop(i); });
+    }
+}
+
+JobSystem::~JobSystem()
+{
+    {
+        std::lock_guard lock{m_sleep_mutex};
+        m_is_stopped = true;
+    }
+
+    m_job_available.notify_all();
+
+    for (auto& thread : m_threads) {
+        thread.join();
+    }
+}
+
+void JobSystem::run(Job job, Counter* counter, Counter* dependency)
+{
+    auto task = makeShared<RangeJob>(
+        [job = std::move(job)](uint32_t, uint32_t, uint32_t worker_index) { job(worker_index); });
+
+    if (counter != nullptr) {
+        std::lock_guard lock{counter->m_mutex};
+        counter->m_pending++;
+    }
+
+    schedule({{std::move(task), 0, 1, counter}}, dependency);
+}
+
+void JobSystem::parallelFor(uint32_t item_count,
+                            uint32_t min_range,
+                            RangeJob job,
+                            Counter* counter,
+                            Counter* dependency)
+{
+    if (item_count == 0) {
+        return;
+    }
+
+    // Split the items evenly between the workers, but not into ranges shorter than requested
+    uint32_t range = std::max({min_range, 1U, (item_count + workerCount() - 1) / workerCount()});
+    uint32_t job_count = (item_count + range - 1) / range;
+
+    if (counter != nullptr) {
+        std::lock_guard lock{counter->m_mutex};
+        counter->m_pending += job_count;
+    }
+
+    auto               task = makeShared<RangeJob>(std::move(job));
+    std::vector<job_t> jobs;
+    jobs.reserve(job_count);
+
+    for (uint32_t begin{0}; begin < item_count; begin += range) {
+        jobs.push_back({task, begin, std::min(begin + range, item_count), counter});
+    }
+
+    schedule(std::move(jobs), dependency);
+}
+
+void JobSystem::wait(const Counter& counter)
+{
+    uint32_t worker_index = currentWorkerIndex();
+
+    while (!counter.isDone()) {
+        if (!tryRunJob(worker_index)) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void JobSystem::workerLoop(uint32_t worker_index)
+{
+    while (true) {
+        if (tryRunJob(worker_index)) {
+            continue;
+        }
+
+        std::unique_lock lock{m_sleep_mutex};
+        m_job_available.wait(lock, [this] {
+            return m_is_stopped || m_queued_job_count.load(std::memory_order_acquire) > 0;
+        });
+
+        if (m_is_stopped) {
+            return;
+        }
+    }
+}
+
+void JobSystem::schedule(std::vector<job_t> jobs, Counter* dependency)
+{
+    if (dependency != nullptr) {
+        std::lock_guard lock{dependency->m_mutex};
+
+        // The jobs are submitted by the worker, which completes the dependency
+        if (dependency->m_pending > 0) {
+            std::move(jobs.begin(), jobs.end(), std::back_inserter(dependency->m_continuations));
+            return;
+        }
+    }
+
+    submit(std::move(jobs));
+}
+
+void JobSystem::submit(std::vector<job_t> jobs)
+{
+    if (jobs.empty()) {
+        return;
+    }
+
+    // New jobs go to the back of the own queue, so that a worker keeps its data hot, while
+    // the others steal the oldest jobs from the front
+    auto& queue = m_queues[currentWorkerIndex()];
+    auto  job_count = static_cast<uint32_t>(jobs.size());
+
+    {
+        std::lock_guard lock{queue.mutex};
+        std::move(jobs.begin(), jobs.end(), std::back_inserter(queue.jobs));
+    }
+
+    m_queued_job_count.fetch_add(job_count, std::memory_order_release);
+
+    // Taking the lock guarantees that a worker either sees the new jobs or is already asleep
+    {
+        std::lock_guard lock{m_sleep_mutex};
+    }
+
+    if (job_count > 1) {
+        m_job_available.notify_all();
+    } else {
+        m_job_available.notify_one();
+    }
+}
+
+bool JobSystem::tryRunJob(uint32_t worker_index)
+{
+    job_t job;
+
+    if (!tryPopJob(worker_index, &job)) {
+        return false;
+    }
+
+    // A thread helping another job system keeps its own identity after the job is done
+    auto previous_worker = std::exchange(current_worker, {this, worker_index});
+    runJob(job, worker_index);
+    current_worker = previous_worker;
+    return true;
+}
+
+bool JobSystem::tryPopJob(uint32_t worker_index, job_t* job)
+{
+    if (m_queued_job_count.load(std::memory_order_acquire) == 0) {
+        return false;
+    }
+
+    for (uint32_t i{0}; i < workerCount(); i++) {
+        auto& queue = m_queues[(worker_index + i) % workerCount()];
+
+        std::lock_guard lock{queue.mutex};
+        if (queue.jobs.empty()) {
+            continue;
+        }
+
+        if (i == 0) {
+            *job = std::move(queue.jobs.back());
+            queue.jobs.pop_back();
+        } else {
+            *job = std::move(queue.jobs.front());
+            queue.jobs.pop_front();
+        }
+
+        m_queued_job_count.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    return false;
+}
+
+void JobSystem::runJob(const job_t& job, uint32_t worker_index)
+{
+    (*job.task)(job.begin, job.end, worker_index);
+
+    if (job.counter == nullptr) {
+        return;
+    }
+
+    std::vector<job_t> continuations;
+
+    {
+        std::lock_guard lock{job.counter->m_mutex};
+        if (--job.counter->m_pending == 0) {
+            continuations.swap(job.counter->m_continuations);
+        }
+    }
+
+    // The counter may be destroyed by a waiting thread at this point, so it's not touched anymore
+    submit(std::move(continuations));
+}
+
+uint32_t JobSystem::currentWorkerIndex() const
+{
+    return current_worker.system == this ? current_worker.index : CALLER_WORKER_INDEX;
+}
+
+bool JobSystem::Counter::isDone() const
+{
+    std::lock_guard lock{m_mutex};
+    return m_pending == 0;
+}
+
+} // namespace GE
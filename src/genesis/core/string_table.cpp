@@ -0,0 +1,88 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2024, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "string_table.h"
+
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace GE {
+namespace {
+
+struct table_t {
+    std::shared_mutex mutex;
+
+    // A deque never moves its elements, so the keys may point into the stored strings
+    std::deque<std::string>                               strings{std::string{}};
+    std::unordered_map<std::string_view, StringTable::ID> ids{{std::string_view{}, 0}};
+};
+
+table_t& stringTable()
+{
+    static table_t table;
+    return table;
+}
+
+} // namespace
+
+StringTable::ID StringTable::intern(std::string_view string)
+{
+    auto& table = stringTable();
+
+    {
+        std::shared_lock lock{table.mutex};
+        if (auto it = table.ids.find(string); it != table.ids.end()) {
+            return it->second;
+        }
+    }
+
+    std::unique_lock lock{table.mutex};
+    if (auto it = table.ids.find(string); it != table.ids.end()) {
+        return it->second;
+    }
+
+    auto        id = static_cast<ID>(table.strings.size());
+    const auto& stored_string = table.strings.emplace_back(string);
+    table.ids.emplace(stored_string, id);
+    return id;
+}
+
+const std::string& StringTable::string(ID id)
+{
+    auto&            table = stringTable();
+    std::shared_lock lock{table.mutex};
+    return table.strings.at(id);
+}
+
+} // namespace GE
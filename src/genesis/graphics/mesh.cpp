@@ -61,10 +61,11 @@ bool Mesh::fromObj(std::string_view filepath)
     return populateBuffers(reader);
 }
 
-void Mesh::setBuffers(Scoped<VertexBuffer> vbo, Scoped<IndexBuffer> ibo)
+void Mesh::setBuffers(Scoped<VertexBuffer> vbo, Scoped<IndexBuffer> ibo, const aabb_t& bounds)
 {
     m_vbo = std::move(vbo);
     m_ibo = std::move(ibo);
+    m_bounds = bounds;
 }
 
 void Mesh::draw(GPUCommandQueue* queue) const
@@ -78,6 +79,7 @@ void Mesh::destroy()
 {
     m_ibo.reset();
     m_vbo.reset();
+    m_bounds = {};
 }
 
 bool Mesh::populateBuffers(const tinyobj::ObjReader& reader)
@@ -86,6 +88,7 @@ bool Mesh::populateBuffers(const tinyobj::ObjReader& reader)
     std::unordered_map<vertex_t, uint32_t> unique_vertices;
     std::vector<vertex_t>                  vertices;
     std::vector<uint32_t>                  indices;
+    aabb_t                                 bounds;
 
     for (const auto& shape : reader.GetShapes()) {
         for (const auto& index : shape.mesh.indices) {
@@ -103,6 +106,7 @@ bool Mesh::populateBuffers(const tinyobj::ObjReader& reader)
             if (!unique_vertices.contains(vertex)) {
                 unique_vertices[vertex] = vertices.size();
                 vertices.push_back(vertex);
+                bounds.expand(vertex.position);
             }
 
             indices.push_back(unique_vertices[vertex]);
@@ -121,6 +125,7 @@ bool Mesh::populateBuffers(const tinyobj::ObjReader& reader)
         return false;
     }
 
+    m_bounds = bounds;
     return true;
 }
 
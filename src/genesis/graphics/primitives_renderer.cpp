@@ -38,28 +38,30 @@
 
 #include "genesis/core/asserts.h"
 
+#include <algorithm>
+
 namespace GE {
 namespace {
 
 constexpr uint32_t CIRCLE_SEGMENT_COUNT{64};
 constexpr uint32_t BOX_VERTEX_COUNT{4};
 
-constexpr std::string_view SHADER_VERT = R"(
+constexpr std::string_view LINES_SHADER_VERT = R"(
 #version 450
 
 layout(location = 0) in vec2 a_Position;
+layout(location = 1) in vec4 a_Color;
 
 layout(push_constant) uniform u_PushConstants {
-    mat4 transform;
-    vec4 color;
+    mat4 view_projection;
 } pc;
 
 layout(location = 0) out vec4 v_Color;
 
 void main()
 {
-    v_Color = pc.color;
-    gl_Position = pc.transform * vec4(a_Position, 0.0, 1.0);
+    v_Color = a_Color;
+    gl_Position = pc.view_projection * vec4(a_Position, 0.0, 1.0);
 }
 )";
 
@@ -76,14 +78,16 @@ void main()
 }
 )";
 
-Scoped<Pipeline> createPipeline(Renderer* renderer)
+Scoped<Pipeline> createPipeline(Renderer*         renderer,
+                                PrimitiveTopology topology,
+                                std::string_view  vertex_shader)
 {
     pipeline_config_t config;
-    config.primitive_topology = PrimitiveTopology::LINE_STRIP;
+    config.primitive_topology = topology;
     config.depth_test_enable = false;
     config.depth_write_enable = false;
 
-    config.vertex_shader->compileFromSource(SHADER_VERT.data());
+    config.vertex_shader->compileFromSource(vertex_shader.data());
     GE_CORE_ASSERT(config.vertex_shader, "Failed to complie vertex shader");
 
     config.fragment_shader->compileFromSource(SHADER_FRAG.data());
@@ -92,67 +96,89 @@ Scoped<Pipeline> createPipeline(Renderer* renderer)
     return renderer->createPipeline(config);
 }
 
-Scoped<VertexBuffer> createCircleVBO(uint64_t segment_count)
+std::vector<Vec2> unitCirclePoints(uint64_t segment_count)
 {
-    constexpr float CIRCLE_RADIUS{0.5f};
-
     float             angle = 2.0f * M_PI / segment_count;
-    std::vector<Vec2> vertices(segment_count);
+    std::vector<Vec2> points(segment_count);
 
     for (uint64_t i{0}; i < segment_count; i++) {
         float point_angle = angle * i;
-        vertices[i] = Vec2{std::sin(point_angle), std::cos(point_angle)} * CIRCLE_RADIUS;
+        points[i] = Vec2{std::sin(point_angle), std::cos(point_angle)};
     }
 
-    vertices.push_back(vertices[0]);
-    return VertexBuffer::create(vertices.size() * sizeof(Vec2), vertices.data());
-}
-
-Scoped<VertexBuffer> createSquareVBO()
-{
-    constexpr std::array<Vec2, 5> SQUARE_VERTICES = {
-        Vec2{-0.5f, 0.5f}, Vec2{0.5f, 0.5f}, Vec2{0.5f, -0.5f}, Vec2{-0.5, -0.5}, Vec2{-0.5, 0.5},
-    };
-
-    return VertexBuffer::create(SQUARE_VERTICES.size() * sizeof(Vec2), SQUARE_VERTICES.data());
+    return points;
 }
 
 } // namespace
 
 PrimitivesRenderer::PrimitivesRenderer(Renderer* renderer)
     : m_renderer{renderer}
-    , m_pipeline{createPipeline(m_renderer)}
-    , m_circle_vbo{createCircleVBO(CIRCLE_SEGMENT_COUNT)}
-    , m_square_vbo{createSquareVBO()}
+    , m_lines_pipeline{createPipeline(m_renderer, PrimitiveTopology::LINE_LIST, LINES_SHADER_VERT)}
+    , m_circle_points{unitCirclePoints(CIRCLE_SEGMENT_COUNT)}
 {}
 
 PrimitivesRenderer::~PrimitivesRenderer() = default;
 
-void PrimitivesRenderer::begin()
+void PrimitivesRenderer::addLine(const Vec2& from, const Vec2& to, const Vec4& color)
 {
-    m_renderer->command()->bind(m_pipeline.get());
+    m_line_vertices.push_back({from, color});
+    m_line_vertices.push_back({to, color});
 }
 
-void PrimitivesRenderer::end() {}
+void PrimitivesRenderer::addSquare(const Mat4& transform, const Vec4& color)
+{
+    std::array<Vec2, BOX_VERTEX_COUNT> corners{};
+
+    for (uint32_t i{0}; i < BOX_VERTEX_COUNT; i++) {
+        Vec2 corner{i == 0 || i == 3 ? -0.5f : 0.5f, i < 2 ? 0.5f : -0.5f};
+        corners[i] = Vec2{transform * Vec4{corner, 0.0f, 1.0f}};
+    }
+
+    for (uint32_t i{0}; i < BOX_VERTEX_COUNT; i++) {
+        addLine(corners[i], corners[(i + 1) % BOX_VERTEX_COUNT], color);
+    }
+}
 
-void PrimitivesRenderer::renderCircle(const Mat4& transform, const Vec4& color)
+void PrimitivesRenderer::addCircle(const Vec2& center, float radius, const Vec4& color)
 {
+    for (uint32_t i{0}; i < CIRCLE_SEGMENT_COUNT; i++) {
+        addLine(center + m_circle_points[i] * radius,
+                center + m_circle_points[(i + 1) % CIRCLE_SEGMENT_COUNT] * radius, color);
+    }
+}
+
+void PrimitivesRenderer::renderLines(const Mat4& view_projection)
+{
+    if (m_line_vertices.empty()) {
+        return;
+    }
+
+    auto  size = static_cast<uint32_t>(m_line_vertices.size() * sizeof(line_vertex_t));
+    auto& vbo = nextLineVBO(size);
+    vbo->setVertices(m_line_vertices.data(), size);
+
     auto* cmd = m_renderer->command();
-    auto* pipeline = m_pipeline.get();
+    auto* pipeline = m_lines_pipeline.get();
+
+    cmd->bind(pipeline);
+    cmd->pushConstant(pipeline, "pc.view_projection", view_projection);
+    cmd->draw(vbo.get(), static_cast<uint32_t>(m_line_vertices.size()));
 
-    cmd->pushConstant(pipeline, "pc.transform", transform);
-    cmd->pushConstant(pipeline, "pc.color", color);
-    cmd->draw(m_circle_vbo.get(), CIRCLE_SEGMENT_COUNT + 1);
+    m_line_vertices.clear();
 }
 
-void PrimitivesRenderer::renderSquare(const Mat4& transform, const Vec4& color)
+Scoped<VertexBuffer>& PrimitivesRenderer::nextLineVBO(uint32_t size)
 {
-    auto* cmd = m_renderer->command();
-    auto* pipeline = m_pipeline.get();
+    m_line_vbo_index = (m_line_vbo_index + 1) % LINE_VBO_COUNT;
+    auto& vbo = m_line_vbos[m_line_vbo_index];
+
+    // Grow geometrically, so a scene adding colliders doesn't reallocate every frame
+    if (vbo == nullptr || vbo->size() < size) {
+        uint32_t capacity = vbo != nullptr ? vbo->size() : 0;
+        vbo = VertexBuffer::create(std::max(size, capacity * 2));
+    }
 
-    cmd->pushConstant(pipeline, "pc.transform", transform);
-    cmd->pushConstant(pipeline, "pc.color", color);
-    cmd->draw(m_square_vbo.get(), BOX_VERTEX_COUNT + 1);
+    return vbo;
 }
 
 } // namespace GE
@@ -105,6 +105,16 @@ void RenderCommand::draw(uint32_t vertex_count,
     m_renderer->draw(&m_cmd_queue, vertex_count, instance_count, first_vertex, first_instance);
 }
 
+void RenderCommand::drawIndexed(uint32_t index_count,
+                                uint32_t instance_count,
+                                uint32_t first_index,
+                                int32_t  vertex_offset,
+                                uint32_t first_instance)
+{
+    m_renderer->drawIndexed(&m_cmd_queue, index_count, instance_count, first_index,
+                            vertex_offset, first_instance);
+}
+
 void RenderCommand::submit(GPUCommandBuffer cmd)
 {
     m_cmd_queue.submit(cmd);
@@ -37,8 +37,8 @@ namespace GE::Vulkan {
 UniformBuffer::UniformBuffer(Shared<Device> device, uint32_t size, const void* data)
     : Vulkan::BufferBase{std::move(device)}
 {
-    VkBufferUsageFlags usage =
-        VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT;
+    VkBufferUsageFlags usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT |
+                               VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT;
     VkMemoryPropertyFlagBits properties = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
     createBuffer(size, usage, properties);
 
@@ -75,6 +75,8 @@ void Framebuffer::resize(const Vec2& size)
         return;
     }
 
+    // The attachments may still be used by a frame in flight
+    m_device->waitIdle();
     clearResources();
 
     m_config.size = size;
@@ -42,8 +42,8 @@ class PipelineBarrier
 public:
     static void submit(VkCommandBuffer                          cmd,
                        const std::vector<VkImageMemoryBarrier>& barriers,
-                       VkPipelineStageFlagBits                  src_stage,
-                       VkPipelineStageFlagBits                  dst_stage);
+                       VkPipelineStageFlags                     src_stage,
+                       VkPipelineStageFlags                     dst_stage);
 };
 
 constexpr VkImageAspectFlags toVkAspect(VkFormat format)
@@ -0,0 +1,266 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2024, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "readback_queue.h"
+#include "buffers/staging_buffer.h"
+#include "device.h"
+#include "image.h"
+#include "pipeline_barrier.h"
+#include "texture.h"
+
+#include "genesis/core/log.h"
+
+#include <algorithm>
+#include <functional>
+
+namespace GE::Vulkan {
+namespace {
+
+VkImageMemoryBarrier makeImageBarrier(VkImage image, VkFormat format)
+{
+    VkImageMemoryBarrier barrier{};
+    barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.image = image;
+    barrier.subresourceRange.aspectMask = toVkAspect(format);
+    barrier.subresourceRange.baseMipLevel = 0;
+    barrier.subresourceRange.levelCount = 1;
+    barrier.subresourceRange.baseArrayLayer = 0;
+    barrier.subresourceRange.layerCount = 1;
+    return barrier;
+}
+
+} // namespace
+
+ReadbackQueue::ReadbackQueue(Shared<Device> device)
+    : m_device{std::move(device)}
+{}
+
+ReadbackQueue::~ReadbackQueue() = default;
+
+void ReadbackQueue::enqueue(const Image*      image,
+                            VkImageLayout     layout,
+                            const VkOffset2D& offset,
+                            const VkExtent2D& extent,
+                            ReadbackCallback  callback)
+{
+    uint32_t size = extent.width * extent.height * toTextureBPP(toTextureFormat(image->format()));
+    if (size == 0) {
+        GE_CORE_ERR("Failed to enqueue readback: empty region or unsupported format");
+        return;
+    }
+
+    request_t request{};
+    request.image = image->image();
+    request.format = image->format();
+    request.layout = layout;
+    request.offset = offset;
+    request.extent = extent;
+    request.size = size;
+    request.callback = std::move(callback);
+    request.buffer = acquireBuffer(size);
+
+    m_pending_requests.push_back(std::move(request));
+}
+
+void ReadbackQueue::enqueue(VkBuffer         buffer,
+                            VkDeviceSize     offset,
+                            uint32_t         size,
+                            ReadbackCallback callback)
+{
+    if (buffer == VK_NULL_HANDLE || size == 0) {
+        GE_CORE_ERR("Failed to enqueue readback: empty buffer region");
+        return;
+    }
+
+    request_t request{};
+    request.src_buffer = buffer;
+    request.src_offset = offset;
+    request.size = size;
+    request.callback = std::move(callback);
+    request.buffer = acquireBuffer(size);
+
+    m_pending_requests.push_back(std::move(request));
+}
+
+void ReadbackQueue::record(VkCommandBuffer cmd)
+{
+    for (auto& request : m_pending_requests) {
+        recordCopy(cmd, request);
+        m_recorded_requests.push_back(std::move(request));
+    }
+
+    m_pending_requests.clear();
+}
+
+void ReadbackQueue::onSubmitted(VkFence fence)
+{
+    for (auto& request : m_recorded_requests) {
+        request.fence = fence;
+        m_submitted_requests.push_back(std::move(request));
+    }
+
+    m_recorded_requests.clear();
+}
+
+void ReadbackQueue::poll()
+{
+    auto is_completed = [this](const request_t& request) {
+        return vkGetFenceStatus(m_device->device(), request.fence) == VK_SUCCESS;
+    };
+
+    auto completed = std::stable_partition(m_submitted_requests.begin(),
+                                           m_submitted_requests.end(), std::not_fn(is_completed));
+
+    for (auto it = completed; it != m_submitted_requests.end(); ++it) {
+        it->callback(it->buffer->data(), it->size);
+        releaseBuffer(std::move(it->buffer));
+    }
+
+    m_submitted_requests.erase(completed, m_submitted_requests.end());
+}
+
+bool ReadbackQueue::isEmpty() const
+{
+    return m_pending_requests.empty() && m_recorded_requests.empty() &&
+           m_submitted_requests.empty();
+}
+
+void ReadbackQueue::recordCopy(VkCommandBuffer cmd, const request_t& request)
+{
+    if (request.image != VK_NULL_HANDLE) {
+        recordImageCopy(cmd, request);
+    } else {
+        recordBufferCopy(cmd, request);
+    }
+
+    VkBufferMemoryBarrier host_barrier{};
+    host_barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+    host_barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    host_barrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+    host_barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    host_barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    host_barrier.buffer = toVkBuffer(request.buffer->nativeHandle());
+    host_barrier.offset = 0;
+    host_barrier.size = VK_WHOLE_SIZE;
+
+    vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT, 0, 0,
+                         nullptr, 1, &host_barrier, 0, nullptr);
+}
+
+void ReadbackQueue::recordImageCopy(VkCommandBuffer cmd, const request_t& request)
+{
+    auto to_transfer_barrier = makeImageBarrier(request.image, request.format);
+    to_transfer_barrier.srcAccessMask = VK_ACCESS_MEMORY_WRITE_BIT;
+    to_transfer_barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+    to_transfer_barrier.oldLayout = request.layout;
+    to_transfer_barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+
+    PipelineBarrier::submit(cmd, {to_transfer_barrier}, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                            VK_PIPELINE_STAGE_TRANSFER_BIT);
+
+    VkBufferImageCopy region{};
+    region.bufferOffset = 0;
+    region.bufferRowLength = 0;
+    region.bufferImageHeight = 0;
+    region.imageSubresource.aspectMask = toVkAspect(request.format);
+    region.imageSubresource.mipLevel = 0;
+    region.imageSubresource.baseArrayLayer = 0;
+    region.imageSubresource.layerCount = 1;
+    region.imageOffset = {request.offset.x, request.offset.y, 0};
+    region.imageExtent = {request.extent.width, request.extent.height, 1};
+
+    vkCmdCopyImageToBuffer(cmd, request.image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                           toVkBuffer(request.buffer->nativeHandle()), 1, &region);
+
+    auto restore_barrier = makeImageBarrier(request.image, request.format);
+    restore_barrier.srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+    restore_barrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+    restore_barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+    restore_barrier.newLayout = request.layout;
+
+    PipelineBarrier::submit(cmd, {restore_barrier}, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                            VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+}
+
+void ReadbackQueue::recordBufferCopy(VkCommandBuffer cmd, const request_t& request)
+{
+    VkBufferMemoryBarrier to_transfer_barrier{};
+    to_transfer_barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+    to_transfer_barrier.srcAccessMask = VK_ACCESS_MEMORY_WRITE_BIT;
+    to_transfer_barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+    to_transfer_barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    to_transfer_barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    to_transfer_barrier.buffer = request.src_buffer;
+    to_transfer_barrier.offset = request.src_offset;
+    to_transfer_barrier.size = request.size;
+
+    vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                         0, 0, nullptr, 1, &to_transfer_barrier, 0, nullptr);
+
+    VkBufferCopy region{};
+    region.srcOffset = request.src_offset;
+    region.dstOffset = 0;
+    region.size = request.size;
+
+    vkCmdCopyBuffer(cmd, request.src_buffer, toVkBuffer(request.buffer->nativeHandle()), 1,
+                    &region);
+}
+
+Scoped<StagingBuffer> ReadbackQueue::acquireBuffer(uint32_t size)
+{
+    auto it = std::ranges::min_element(m_buffer_pool, [size](const auto& lhs, const auto& rhs) {
+        bool lhs_fits = lhs->size() >= size;
+        bool rhs_fits = rhs->size() >= size;
+        return lhs_fits != rhs_fits ? lhs_fits : lhs->size() < rhs->size();
+    });
+
+    if (it != m_buffer_pool.end() && (*it)->size() >= size) {
+        auto buffer = std::move(*it);
+        m_buffer_pool.erase(it);
+        return buffer;
+    }
+
+    auto buffer = makeScoped<StagingBuffer>(m_device);
+    buffer->resize(size);
+    return buffer;
+}
+
+void ReadbackQueue::releaseBuffer(Scoped<StagingBuffer> buffer)
+{
+    if (m_buffer_pool.size() < MAX_POOLED_BUFFERS) {
+        m_buffer_pool.push_back(std::move(buffer));
+    }
+}
+
+} // namespace GE::Vulkan
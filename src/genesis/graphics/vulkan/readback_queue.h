@@ -0,0 +1,101 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2024, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <genesis/core/interface.h>
+#include <genesis/core/memory.h>
+#include <genesis/graphics/renderer.h>
+
+#include <vulkan/vulkan.h>
+
+#include <vector>
+
+namespace GE::Vulkan {
+
+class Device;
+class Image;
+class StagingBuffer;
+
+class ReadbackQueue: public NonCopyable
+{
+public:
+    explicit ReadbackQueue(Shared<Device> device);
+    ~ReadbackQueue();
+
+    // The image is expected in 'layout' when the copy runs and is returned to it afterwards
+    void enqueue(const Image*      image,
+                 VkImageLayout     layout,
+                 const VkOffset2D& offset,
+                 const VkExtent2D& extent,
+                 ReadbackCallback  callback);
+    void enqueue(VkBuffer buffer, VkDeviceSize offset, uint32_t size, ReadbackCallback callback);
+
+    void record(VkCommandBuffer cmd);
+    void onSubmitted(VkFence fence);
+    void poll();
+
+    bool isEmpty() const;
+
+    static constexpr size_t MAX_POOLED_BUFFERS{8};
+
+private:
+    struct request_t {
+        VkImage               image{VK_NULL_HANDLE};
+        VkFormat              format{VK_FORMAT_UNDEFINED};
+        VkImageLayout         layout{VK_IMAGE_LAYOUT_UNDEFINED};
+        VkOffset2D            offset{};
+        VkExtent2D            extent{};
+        VkBuffer              src_buffer{VK_NULL_HANDLE};
+        VkDeviceSize          src_offset{0};
+        uint32_t              size{0};
+        ReadbackCallback      callback;
+        Scoped<StagingBuffer> buffer;
+        VkFence               fence{VK_NULL_HANDLE};
+    };
+
+    void recordCopy(VkCommandBuffer cmd, const request_t& request);
+    void recordImageCopy(VkCommandBuffer cmd, const request_t& request);
+    void recordBufferCopy(VkCommandBuffer cmd, const request_t& request);
+
+    Scoped<StagingBuffer> acquireBuffer(uint32_t size);
+    void releaseBuffer(Scoped<StagingBuffer> buffer);
+
+    Shared<Device> m_device;
+
+    std::vector<request_t>             m_pending_requests;
+    std::vector<request_t>             m_recorded_requests;
+    std::vector<request_t>             m_submitted_requests;
+    std::vector<Scoped<StagingBuffer>> m_buffer_pool;
+};
+
+} // namespace GE::Vulkan
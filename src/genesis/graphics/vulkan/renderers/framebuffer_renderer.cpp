@@ -80,6 +80,8 @@ FramebufferRenderer::~FramebufferRenderer()
 
 bool FramebufferRenderer::beginFrame(Renderer::ClearMode clear_mode)
 {
+    waitForPreviousFrame();
+
     if (!beginRendering(clear_mode)) {
         return false;
     }
@@ -94,12 +96,11 @@ void FramebufferRenderer::endFrame()
     endRendering();
 }
 
+// The frame isn't waited for here, the readbacks are delivered by a later poll once it's finished
 void FramebufferRenderer::swapBuffers()
 {
-    submit();
-    vkWaitForFences(m_device->device(), 1, &m_in_flight_fence, VK_TRUE,
-                    std::numeric_limits<uint64_t>::max());
-    m_descriptor_pool->reset();
+    m_is_frame_in_flight = submit();
+    m_readback_queue.poll();
 }
 
 Vec2 FramebufferRenderer::size() const
@@ -144,6 +145,20 @@ void FramebufferRenderer::createSyncObjects()
     }
 }
 
+// The command buffer and the descriptor pool are reused, so the previous frame has to be finished
+void FramebufferRenderer::waitForPreviousFrame()
+{
+    if (!m_is_frame_in_flight) {
+        return;
+    }
+
+    vkWaitForFences(m_device->device(), 1, &m_in_flight_fence, VK_TRUE,
+                    std::numeric_limits<uint64_t>::max());
+    m_is_frame_in_flight = false;
+    m_descriptor_pool->reset();
+    m_readback_queue.poll();
+}
+
 void FramebufferRenderer::destroyVkHandles()
 {
     vkDestroyFence(m_device->device(), m_in_flight_fence, nullptr);
@@ -172,14 +187,16 @@ bool FramebufferRenderer::submit()
         return false;
     }
 
+    m_readback_queue.onSubmitted(m_in_flight_fence);
     return true;
 }
 
 void FramebufferRenderer::transitImageLayoutBeforeRendering(VkCommandBuffer cmd)
 {
-    // Color attachments
+    std::vector<VkImageMemoryBarrier> barriers;
+    VkPipelineStageFlags              dst_stages{VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT};
 
-    std::vector<VkImageMemoryBarrier> color_barriers;
+    // Color attachments
 
     for (uint32_t i{0}; i < m_framebuffer->colorAttachmentCount(); i++) {
         auto barrier = m_framebuffer->colorTexture(i).image()->imageMemoryBarrier();
@@ -189,12 +206,9 @@ void FramebufferRenderer::transitImageLayoutBeforeRendering(VkCommandBuffer cmd)
         barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
         barrier.newLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
 
-        color_barriers.push_back(barrier);
+        barriers.push_back(barrier);
     }
 
-    PipelineBarrier::submit(cmd, color_barriers, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
-                            VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT);
-
     // Depth attachment
 
     if (m_framebuffer->hasDepthAttachment()) {
@@ -205,43 +219,48 @@ void FramebufferRenderer::transitImageLayoutBeforeRendering(VkCommandBuffer cmd)
         barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
         barrier.newLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
 
-        PipelineBarrier::submit(cmd, {barrier}, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
-                                VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT);
+        barriers.push_back(barrier);
+        dst_stages |= VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT;
     }
+
+    // All attachments are transitioned by a single barrier
+    PipelineBarrier::submit(cmd, barriers, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, dst_stages);
 }
 
 void FramebufferRenderer::transitImageLayoutAfterRendering(VkCommandBuffer cmd)
 {
-    // Color attachments
+    std::vector<VkImageMemoryBarrier> barriers;
+    VkPipelineStageFlags              src_stages{VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT};
 
-    std::vector<VkImageMemoryBarrier> color_barriers;
+    // Color attachments
 
     for (uint32_t i{0}; i < m_framebuffer->colorAttachmentCount(); i++) {
         auto barrier = m_framebuffer->colorTexture(i).image()->imageMemoryBarrier();
         barrier.srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
-        barrier.dstAccessMask = VK_ACCESS_NONE;
+        barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
         barrier.oldLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
         barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
 
-        color_barriers.push_back(barrier);
+        barriers.push_back(barrier);
     }
 
-    PipelineBarrier::submit(cmd, color_barriers, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
-                            VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT);
-
     // Depth attachment
 
     if (m_framebuffer->hasDepthAttachment()) {
         auto barrier = m_framebuffer->depthTexture().image()->imageMemoryBarrier();
         barrier.srcAccessMask = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT |
                                 VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
-        barrier.dstAccessMask = VK_ACCESS_NONE;
+        barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
         barrier.oldLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
         barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
 
-        PipelineBarrier::submit(cmd, {barrier}, VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT,
-                                VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT);
+        barriers.push_back(barrier);
+        src_stages |= VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
     }
+
+    // Without a CPU wait after the submission, the barrier makes the attachments visible to the
+    // passes sampling them later in the queue
+    PipelineBarrier::submit(cmd, barriers, src_stages, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
 }
 
 VkCommandBuffer FramebufferRenderer::cmdBuffer() const
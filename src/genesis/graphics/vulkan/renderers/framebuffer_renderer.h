@@ -57,6 +57,7 @@ public:
 
 private:
     void createSyncObjects();
+    void waitForPreviousFrame();
     void destroyVkHandles();
 
     bool submit();
@@ -75,6 +76,7 @@ private:
 
     Vulkan::Framebuffer* m_framebuffer{nullptr};
     VkFence              m_in_flight_fence{VK_NULL_HANDLE};
+    bool                 m_is_frame_in_flight{false};
 };
 
 } // namespace GE::Vulkan
@@ -31,6 +31,7 @@
  */
 
 #include "renderer_base.h"
+#include "buffers/buffer_base.h"
 #include "command_buffer.h"
 #include "descriptor_pool.h"
 #include "device.h"
@@ -38,11 +39,17 @@
 #include "utils.h"
 #include "vulkan_exception.h"
 
+#include "genesis/core/log.h"
+#include "genesis/graphics/index_buffer.h"
+#include "genesis/graphics/uniform_buffer.h"
+#include "genesis/graphics/vertex_buffer.h"
+
 namespace GE::Vulkan {
 
 RendererBase::RendererBase(Shared<Device> device)
     : m_device{std::move(device)}
     , m_descriptor_pool{makeShared<DescriptorPool>(m_device)}
+    , m_readback_queue{m_device}
 {
     createCommandPool();
     createPipelineCache();
@@ -143,6 +150,7 @@ bool RendererBase::endRendering()
 
     cmdEndRendering(cmd);
     transitImageLayoutAfterRendering(cmd);
+    m_readback_queue.record(cmd);
 
     if (vkEndCommandBuffer(cmd) != VK_SUCCESS) {
         GE_CORE_ERR("Failed to end Command Buffer");
@@ -164,6 +172,78 @@ void RendererBase::draw(GPUCommandQueue* queue,
     });
 }
 
+void RendererBase::drawIndexed(GPUCommandQueue* queue,
+                               uint32_t         index_count,
+                               uint32_t         instance_count,
+                               uint32_t         first_index,
+                               int32_t          vertex_offset,
+                               uint32_t         first_instance)
+{
+    queue->enqueue(
+        [index_count, instance_count, first_index, vertex_offset, first_instance](void* cmd) {
+            vkCmdDrawIndexed(toVkCommandBuffer(cmd), index_count, instance_count, first_index,
+                             vertex_offset, first_instance);
+        });
+}
+
+void RendererBase::enqueueReadback(const GE::Texture& texture,
+                                   const Vec2&        offset,
+                                   const Vec2&        size,
+                                   ReadbackCallback   callback)
+{
+    VkOffset2D vk_offset{static_cast<int32_t>(offset.x), static_cast<int32_t>(offset.y)};
+    VkExtent2D vk_extent{static_cast<uint32_t>(size.x), static_cast<uint32_t>(size.y)};
+
+    // Sampled textures and framebuffer attachments rest in the shader read layout between passes
+    m_readback_queue.enqueue(toVulkan(texture).image().get(),
+                             VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, vk_offset, vk_extent,
+                             std::move(callback));
+}
+
+void RendererBase::enqueueReadback(const GE::VertexBuffer& buffer,
+                                   uint32_t                offset,
+                                   uint32_t                size,
+                                   ReadbackCallback        callback)
+{
+    enqueueBufferReadback(buffer.nativeHandle(), buffer.size(), offset, size, std::move(callback));
+}
+
+void RendererBase::enqueueReadback(const GE::IndexBuffer& buffer,
+                                   uint32_t               offset,
+                                   uint32_t               size,
+                                   ReadbackCallback       callback)
+{
+    enqueueBufferReadback(buffer.nativeHandle(), buffer.size(), offset, size, std::move(callback));
+}
+
+void RendererBase::enqueueReadback(const GE::UniformBuffer& buffer,
+                                   uint32_t                 offset,
+                                   uint32_t                 size,
+                                   ReadbackCallback         callback)
+{
+    enqueueBufferReadback(buffer.nativeHandle(), buffer.size(), offset, size, std::move(callback));
+}
+
+void RendererBase::pollReadbacks()
+{
+    m_readback_queue.poll();
+}
+
+void RendererBase::enqueueBufferReadback(void*            buffer,
+                                         uint32_t         buffer_size,
+                                         uint32_t         offset,
+                                         uint32_t         size,
+                                         ReadbackCallback callback)
+{
+    if (offset > buffer_size || size > buffer_size - offset) {
+        GE_CORE_ERR("Failed to enqueue readback: region [{}, {}) exceeds buffer size {}", offset,
+                    offset + size, buffer_size);
+        return;
+    }
+
+    m_readback_queue.enqueue(toVkBuffer(buffer), offset, size, std::move(callback));
+}
+
 void RendererBase::destroyVkHandles()
 {
     m_device->waitIdle();
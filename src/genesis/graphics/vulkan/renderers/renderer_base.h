@@ -36,6 +36,8 @@
 #include <genesis/graphics/framebuffer.h>
 #include <genesis/graphics/renderer.h>
 
+#include "readback_queue.h"
+
 #include <vulkan/vulkan.h>
 
 #include <optional>
@@ -53,6 +55,24 @@ public:
 
     RenderCommand* command() override { return &m_render_command; }
 
+    void enqueueReadback(const GE::Texture& texture,
+                         const Vec2&        offset,
+                         const Vec2&        size,
+                         ReadbackCallback   callback) override;
+    void enqueueReadback(const GE::VertexBuffer& buffer,
+                         uint32_t                offset,
+                         uint32_t                size,
+                         ReadbackCallback        callback) override;
+    void enqueueReadback(const GE::IndexBuffer& buffer,
+                         uint32_t               offset,
+                         uint32_t               size,
+                         ReadbackCallback       callback) override;
+    void enqueueReadback(const GE::UniformBuffer& buffer,
+                         uint32_t                 offset,
+                         uint32_t                 size,
+                         ReadbackCallback         callback) override;
+    void pollReadbacks() override;
+
 protected:
     explicit RendererBase(Shared<Device> device);
 
@@ -69,6 +89,12 @@ protected:
               uint32_t         instance_count,
               uint32_t         first_vertex,
               uint32_t         first_instance) override;
+    void drawIndexed(GPUCommandQueue* queue,
+                     uint32_t         index_count,
+                     uint32_t         instance_count,
+                     uint32_t         first_index,
+                     int32_t          vertex_offset,
+                     uint32_t         first_instance) override;
 
     virtual void transitImageLayoutBeforeRendering(VkCommandBuffer cmd) = 0;
     virtual void transitImageLayoutAfterRendering(VkCommandBuffer cmd) = 0;
@@ -90,8 +116,15 @@ protected:
     std::vector<VkCommandBuffer> m_cmd_buffers;
 
     RenderCommand m_render_command{this};
+    ReadbackQueue m_readback_queue;
 
 private:
+    void enqueueBufferReadback(void*            buffer,
+                               uint32_t         buffer_size,
+                               uint32_t         offset,
+                               uint32_t         size,
+                               ReadbackCallback callback);
+
     void destroyVkHandles();
 };
 
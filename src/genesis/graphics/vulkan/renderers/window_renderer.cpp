@@ -90,6 +90,8 @@ bool WindowRenderer::beginFrame(ClearMode clear_mode)
         return false;
     }
 
+    m_readback_queue.poll();
+
     if (!beginRendering(clear_mode)) {
         return false;
     }
@@ -108,7 +110,9 @@ void WindowRenderer::endFrame()
 void WindowRenderer::swapBuffers()
 {
     VkCommandBuffer* cmd = &m_cmd_buffers[m_swap_chain->currentImageIndex()];
-    m_swap_chain->submitCommandBuffer(cmd);
+    if (m_swap_chain->submitCommandBuffer(cmd) == VK_SUCCESS) {
+        m_readback_queue.onSubmitted(m_swap_chain->inFlightFence());
+    }
 
     auto present_result = m_swap_chain->presentImage();
 
@@ -75,6 +75,7 @@ public:
     uint32_t imageCount() const { return m_swap_chain_images.size(); }
     uint32_t minImageCount() const { return m_min_image_count; }
     uint32_t currentImageIndex() const { return m_current_image; }
+    VkFence inFlightFence() const { return m_in_flight_fences[m_current_frame]; }
 
     static VkSurfaceFormatKHR chooseSurfaceFormat(const std::vector<VkSurfaceFormatKHR>& formats);
 
@@ -70,6 +70,22 @@ void RigidBody::setFixedRotation(bool flag)
     b2Body_SetFixedRotation(m_body, flag);
 }
 
+void RigidBody::setUserData(uint64_t user_data)
+{
+    b2Body_SetUserData(m_body, toB2UserData(user_data));
+}
+
+void RigidBody::setState(const body_state_t& state)
+{
+    b2Body_SetTransform(m_body, toB2Vec2(state.position),
+                        b2Rot{state.rotation.x, state.rotation.y});
+    b2Body_SetLinearVelocity(m_body, toB2Vec2(state.linear_velocity));
+    b2Body_SetAngularVelocity(m_body, state.angular_velocity);
+
+    // Setting a velocity wakes the body up, so the sleep state goes last
+    b2Body_SetAwake(m_body, state.is_awake);
+}
+
 bool RigidBody::isFixedRotation() const
 {
     return b2Body_IsFixedRotation(m_body);
@@ -85,6 +101,24 @@ float RigidBody::angle() const
     return b2Rot_GetAngle(b2Body_GetRotation(m_body));
 }
 
+pose_t RigidBody::pose() const
+{
+    return toPose(b2Body_GetTransform(m_body));
+}
+
+uint64_t RigidBody::userData() const
+{
+    return fromB2UserData(b2Body_GetUserData(m_body));
+}
+
+body_state_t RigidBody::state() const
+{
+    auto transform = b2Body_GetTransform(m_body);
+    return {toVec2(transform.p), Vec2{transform.q.c, transform.q.s},
+            toVec2(b2Body_GetLinearVelocity(m_body)), b2Body_GetAngularVelocity(m_body),
+            b2Body_IsAwake(m_body)};
+}
+
 RigidBody::Type toRigidBody(b2BodyType type)
 {
     switch (type) {
@@ -109,4 +143,9 @@ RigidBody::Type toRigidBody(b2BodyType type)
     return b2_staticBody;
 }
 
+pose_t toPose(const b2Transform& transform)
+{
+    return {toVec2(transform.p), b2Rot_GetAngle(transform.q)};
+}
+
 } // namespace GE::P2D::Box2D
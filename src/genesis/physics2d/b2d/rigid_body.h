@@ -37,6 +37,8 @@
 #include <box2d/id.h>
 #include <box2d/types.h>
 
+#include <cstdint>
+
 namespace GE::P2D::Box2D {
 
 class RigidBody: public GE::P2D::RigidBody
@@ -49,10 +51,15 @@ public:
     void createShape(const circle_body_shape_config_t& shape_config) override;
 
     void setFixedRotation(bool flag) override;
+    void setUserData(uint64_t user_data) override;
+    void setState(const body_state_t& state) override;
 
     bool isFixedRotation() const override;
     Vec2 position() const override;
     float angle() const override;
+    pose_t pose() const override;
+    uint64_t userData() const override;
+    body_state_t state() const override;
 
 private:
     b2BodyId m_body{b2_nullBodyId};
@@ -60,5 +67,16 @@ private:
 
 RigidBody::Type toRigidBody(b2BodyType type);
 b2BodyType fromRigidBody(RigidBody::Type type);
+pose_t toPose(const b2Transform& transform);
+
+inline void* toB2UserData(uint64_t user_data)
+{
+    return reinterpret_cast<void*>(static_cast<uintptr_t>(user_data)); // NOLINT
+}
+
+inline uint64_t fromB2UserData(void* user_data)
+{
+    return reinterpret_cast<uintptr_t>(user_data); // NOLINT
+}
 
 } // namespace GE::P2D::Box2D
@@ -45,6 +45,10 @@ b2ShapeDef toB2ShapeDef(const body_shape_config_base_t& config)
     shape_def.friction = config.friction;
     shape_def.restitution = config.restitution;
     shape_def.density = config.density;
+    shape_def.isSensor = config.is_sensor;
+    shape_def.enableHitEvents = config.enable_hit_events;
+    shape_def.filter.categoryBits = config.filter.category_bits;
+    shape_def.filter.maskBits = config.filter.mask_bits;
     return shape_def;
 }
 
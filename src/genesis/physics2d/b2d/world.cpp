@@ -33,46 +33,383 @@
 #include "world.h"
 #include "math_types.h"
 #include "rigid_body.h"
+#include "rigid_body_shape.h"
+
+#include "genesis/core/asserts.h"
 
 #include <box2d/box2d.h>
 
+#include <algorithm>
+#include <mutex>
+
 namespace GE::P2D::Box2D {
 namespace {
 
-b2WorldId createWorld(const Vec2& gravity)
+// Box2D keeps per-worker contexts in fixed size arrays
+constexpr uint32_t MAX_WORKER_COUNT{64};
+// Queries are cheap, so a worker takes a bunch of them at once
+constexpr uint32_t MIN_BATCH_RANGE{32};
+
+Scoped<JobSystem> createJobSystem(const thread_config_t& threads)
 {
-    b2WorldDef world_def{b2DefaultWorldDef()};
-    world_def.gravity = toB2Vec2(gravity);
+    if (threads.worker_count <= 1) {
+        return nullptr;
+    }
+
+    return makeScoped<JobSystem>(std::min(threads.worker_count, MAX_WORKER_COUNT));
+}
+
+// Box2D finds a free slot for a new world in a global array without any synchronization
+std::mutex& worldSlotsMutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+uint64_t shapeUserData(b2ShapeId shape)
+{
+    return fromB2UserData(b2Body_GetUserData(b2Shape_GetBody(shape)));
+}
+
+b2QueryFilter toB2QueryFilter(const collision_filter_t& filter)
+{
+    return {filter.category_bits, filter.mask_bits};
+}
+
+b2Transform toB2Transform(const pose_t& pose)
+{
+    return {toB2Vec2(pose.position), b2MakeRot(pose.angle)};
+}
+
+b2AABB toB2AABB(const aabb_t& aabb)
+{
+    return {{aabb.min.x, aabb.min.y}, {aabb.max.x, aabb.max.y}};
+}
+
+cast_hit_t toCastHit(b2ShapeId shape, b2Vec2 point, b2Vec2 normal, float fraction)
+{
+    return {shapeUserData(shape), toVec2(point), toVec2(normal), fraction, true};
+}
+
+float closestHitCallback(b2ShapeId shape, b2Vec2 point, b2Vec2 normal, float fraction, void* hit)
+{
+    *static_cast<cast_hit_t*>(hit) = toCastHit(shape, point, normal, fraction);
+
+    // Clipping the cast to the hit leaves only closer shapes to report
+    return fraction;
+}
+
+float allHitsCallback(b2ShapeId shape, b2Vec2 point, b2Vec2 normal, float fraction, void* hits)
+{
+    static_cast<std::vector<cast_hit_t>*>(hits)->push_back(
+        toCastHit(shape, point, normal, fraction));
+    return 1.0f;
+}
 
-    return b2CreateWorld(&world_def);
+bool overlapCallback(b2ShapeId shape, void* user_data)
+{
+    static_cast<std::vector<uint64_t>*>(user_data)->push_back(shapeUserData(shape));
+    return true;
+}
+
+struct aabb_overlap_context_t {
+    b2AABB                 bounds;
+    std::vector<uint64_t>* user_data{nullptr};
+};
+
+bool aabbOverlapCallback(b2ShapeId shape, void* context)
+{
+    auto* overlap = static_cast<aabb_overlap_context_t*>(context);
+
+    // The broadphase reports shapes by their fattened bounds
+    if (b2AABB_Overlaps(b2Shape_GetAABB(shape), overlap->bounds)) {
+        overlap->user_data->push_back(shapeUserData(shape));
+    }
+
+    return true;
 }
 
 } // namespace
 
-World::World(const Vec2& gravity)
-    : m_world{createWorld(gravity)}
-{}
+World::World(const Vec2& gravity, const thread_config_t& threads)
+    : m_jobs{createJobSystem(threads)}
+{
+    b2WorldDef world_def{b2DefaultWorldDef()};
+    world_def.gravity = toB2Vec2(gravity);
+
+    if (m_jobs != nullptr) {
+        world_def.workerCount = static_cast<int32_t>(m_jobs->workerCount());
+        world_def.enqueueTask = &World::enqueueTask;
+        world_def.finishTask = &World::finishTask;
+        world_def.userTaskContext = m_jobs.get();
+    }
+
+    std::lock_guard lock{worldSlotsMutex()};
+    m_world = b2CreateWorld(&world_def);
+}
 
 World::~World()
 {
+    std::lock_guard lock{worldSlotsMutex()};
     b2DestroyWorld(m_world);
 }
 
 void World::step(Timestamp ts, int32_t sub_step_count)
 {
     b2World_Step(m_world, ts.sec(), sub_step_count);
+    collectBodyMoveEvents();
+
+    m_contact_events.clear();
+    collectContactEvents();
+    collectSensorEvents();
+}
+
+void* World::enqueueTask(b2TaskCallback* task,
+                         int32_t         item_count,
+                         int32_t         min_range,
+                         void*           task_context,
+                         void*           user_context)
+{
+    auto* jobs = static_cast<JobSystem*>(user_context);
+    auto  counter = makeScoped<JobSystem::Counter>();
+
+    jobs->parallelFor(
+        item_count, min_range,
+        [task, task_context](uint32_t begin, uint32_t end, uint32_t worker) {
+            task(static_cast<int32_t>(begin), static_cast<int32_t>(end), worker, task_context);
+        },
+        counter.get());
+
+    // Box2D hands the pointer back to finishTask(), which takes the ownership over
+    return counter.release();
+}
+
+void World::finishTask(void* user_task, void* user_context)
+{
+    Scoped<JobSystem::Counter> counter{static_cast<JobSystem::Counter*>(user_task)};
+    static_cast<JobSystem*>(user_context)->wait(*counter);
+}
+
+cast_hit_t World::castRayClosest(const ray_cast_t& ray) const
+{
+    auto result = b2World_CastRayClosest(m_world, toB2Vec2(ray.origin), toB2Vec2(ray.translation),
+                                         toB2QueryFilter(ray.filter));
+
+    if (!result.hit) {
+        return {};
+    }
+
+    return toCastHit(result.shapeId, result.point, result.normal, result.fraction);
+}
+
+void World::castRay(const ray_cast_t& ray, std::vector<cast_hit_t>* hits) const
+{
+    hits->clear();
+    b2World_CastRay(m_world, toB2Vec2(ray.origin), toB2Vec2(ray.translation),
+                    toB2QueryFilter(ray.filter), &allHitsCallback, hits);
+
+    std::sort(hits->begin(), hits->end(), [](const cast_hit_t& lhs, const cast_hit_t& rhs) {
+        return lhs.fraction < rhs.fraction;
+    });
+}
+
+cast_hit_t World::castShape(const box_cast_t& cast) const
+{
+    cast_hit_t hit;
+    auto       polygon = toB2Polygon(cast.shape);
+    b2World_CastPolygon(m_world, &polygon, toB2Transform(cast.pose), toB2Vec2(cast.translation),
+                        toB2QueryFilter(cast.filter), &closestHitCallback, &hit);
+    return hit;
+}
+
+cast_hit_t World::castShape(const circle_cast_t& cast) const
+{
+    cast_hit_t hit;
+    auto       circle = toB2Circle(cast.shape);
+    b2World_CastCircle(m_world, &circle, toB2Transform(cast.pose), toB2Vec2(cast.translation),
+                       toB2QueryFilter(cast.filter), &closestHitCallback, &hit);
+    return hit;
+}
+
+void World::overlap(const aabb_overlap_t& query, std::vector<uint64_t>* user_data) const
+{
+    user_data->clear();
+
+    aabb_overlap_context_t context{toB2AABB(query.bounds), user_data};
+    b2World_OverlapAABB(m_world, context.bounds, toB2QueryFilter(query.filter),
+                        &aabbOverlapCallback, &context);
+}
+
+void World::overlap(const box_overlap_t& query, std::vector<uint64_t>* user_data) const
+{
+    user_data->clear();
+
+    auto polygon = toB2Polygon(query.shape);
+    b2World_OverlapPolygon(m_world, &polygon, toB2Transform(query.pose),
+                           toB2QueryFilter(query.filter), &overlapCallback, user_data);
+}
+
+void World::overlap(const circle_overlap_t& query, std::vector<uint64_t>* user_data) const
+{
+    user_data->clear();
+
+    auto circle = toB2Circle(query.shape);
+    b2World_OverlapCircle(m_world, &circle, toB2Transform(query.pose),
+                          toB2QueryFilter(query.filter), &overlapCallback, user_data);
+}
+
+template<typename Query>
+void World::runBatch(size_t query_count, Query&& query)
+{
+    if (m_jobs == nullptr || query_count <= MIN_BATCH_RANGE) {
+        for (size_t i{0}; i < query_count; i++) {
+            query(i);
+        }
+
+        return;
+    }
+
+    JobSystem::Counter counter;
+    m_jobs->parallelFor(
+        static_cast<uint32_t>(query_count), MIN_BATCH_RANGE,
+        [&query](uint32_t begin, uint32_t end, uint32_t) {
+            for (uint32_t i{begin}; i < end; i++) {
+                query(i);
+            }
+        },
+        &counter);
+    m_jobs->wait(counter);
+}
+
+void World::castRaysClosest(std::span<const ray_cast_t> rays, std::span<cast_hit_t> hits)
+{
+    GE_CORE_ASSERT(hits.size() >= rays.size(), "Not enough space for the ray cast results");
+    runBatch(rays.size(), [this, rays, hits](size_t i) { hits[i] = castRayClosest(rays[i]); });
+}
+
+void World::overlap(std::span<const aabb_overlap_t>  queries,
+                    std::span<std::vector<uint64_t>> user_data)
+{
+    GE_CORE_ASSERT(user_data.size() >= queries.size(), "Not enough space for the overlap results");
+    runBatch(queries.size(),
+             [this, queries, user_data](size_t i) { overlap(queries[i], &user_data[i]); });
+}
+
+void World::collectBodyMoveEvents()
+{
+    auto events = b2World_GetBodyEvents(m_world);
+
+    m_body_move_events.clear();
+    m_body_move_events.reserve(events.moveCount);
+
+    for (int32_t i{0}; i < events.moveCount; i++) {
+        const auto& event = events.moveEvents[i];
+        m_body_move_events.push_back({toPose(event.transform), fromB2UserData(event.userData)});
+    }
+}
+
+void World::collectContactEvents()
+{
+    auto events = b2World_GetContactEvents(m_world);
+
+    for (int32_t i{0}; i < events.beginCount; i++) {
+        const auto& event = events.beginEvents[i];
+        m_contact_events.begin_events.push_back(
+            {shapeUserData(event.shapeIdA), shapeUserData(event.shapeIdB)});
+    }
+
+    // The shapes of an ended contact may have been destroyed during the step
+    for (int32_t i{0}; i < events.endCount; i++) {
+        const auto& event = events.endEvents[i];
+
+        if (b2Shape_IsValid(event.shapeIdA) && b2Shape_IsValid(event.shapeIdB)) {
+            m_contact_events.end_events.push_back(
+                {shapeUserData(event.shapeIdA), shapeUserData(event.shapeIdB)});
+        }
+    }
+
+    for (int32_t i{0}; i < events.hitCount; i++) {
+        const auto& event = events.hitEvents[i];
+        m_contact_events.hit_events.push_back({shapeUserData(event.shapeIdA),
+                                               shapeUserData(event.shapeIdB),
+                                               toVec2(event.point), toVec2(event.normal),
+                                               event.approachSpeed});
+    }
+}
+
+void World::collectSensorEvents()
+{
+    auto events = b2World_GetSensorEvents(m_world);
+
+    for (int32_t i{0}; i < events.beginCount; i++) {
+        const auto& event = events.beginEvents[i];
+        m_contact_events.sensor_begin_events.push_back(
+            {shapeUserData(event.sensorShapeId), shapeUserData(event.visitorShapeId)});
+    }
+
+    for (int32_t i{0}; i < events.endCount; i++) {
+        const auto& event = events.endEvents[i];
+
+        if (b2Shape_IsValid(event.sensorShapeId) && b2Shape_IsValid(event.visitorShapeId)) {
+            m_contact_events.sensor_end_events.push_back(
+                {shapeUserData(event.sensorShapeId), shapeUserData(event.visitorShapeId)});
+        }
+    }
 }
 
 Scoped<P2D::RigidBody> World::createRigidBody(RigidBody::Type type,
                                               const Vec2&     position,
-                                              float           angle)
+                                              float           angle,
+                                              uint64_t        user_data)
 {
     b2BodyDef body_def{b2DefaultBodyDef()};
     body_def.type = fromRigidBody(type);
     body_def.position = toB2Vec2(position);
     body_def.rotation = b2MakeRot(angle);
+    body_def.userData = toB2UserData(user_data);
 
     return makeScoped<Box2D::RigidBody>(b2CreateBody(m_world, &body_def));
 }
 
+std::vector<Scoped<P2D::RigidBody>> World::createRigidBodies(
+    std::span<const body_def_t>         bodies,
+    std::span<const box_shape_def_t>    boxes,
+    std::span<const circle_shape_def_t> circles)
+{
+    m_created_bodies.clear();
+    m_created_bodies.reserve(bodies.size());
+
+    for (const auto& body : bodies) {
+        b2BodyDef body_def{b2DefaultBodyDef()};
+        body_def.type = fromRigidBody(body.type);
+        body_def.position = toB2Vec2(body.pose.position);
+        body_def.rotation = b2MakeRot(body.pose.angle);
+        body_def.fixedRotation = body.fixed_rotation;
+        body_def.userData = toB2UserData(body.user_data);
+
+        m_created_bodies.push_back(b2CreateBody(m_world, &body_def));
+    }
+
+    for (const auto& box : boxes) {
+        auto shape_def = toB2ShapeDef(box.config);
+        auto polygon = toB2Polygon(box.config);
+        b2CreatePolygonShape(m_created_bodies[box.body], &shape_def, &polygon);
+    }
+
+    for (const auto& circle : circles) {
+        auto shape_def = toB2ShapeDef(circle.config);
+        auto circle_shape = toB2Circle(circle.config);
+        b2CreateCircleShape(m_created_bodies[circle.body], &shape_def, &circle_shape);
+    }
+
+    std::vector<Scoped<P2D::RigidBody>> rigid_bodies;
+    rigid_bodies.reserve(m_created_bodies.size());
+
+    for (auto body_id : m_created_bodies) {
+        rigid_bodies.push_back(makeScoped<Box2D::RigidBody>(body_id));
+    }
+
+    return rigid_bodies;
+}
+
 } // namespace GE::P2D::Box2D
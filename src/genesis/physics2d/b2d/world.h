@@ -32,27 +32,71 @@
 
 #pragma once
 
+#include <genesis/core/job_system.h>
 #include <genesis/math/types.h>
 #include <genesis/physics2d/world.h>
 
 #include <box2d/id.h>
+#include <box2d/types.h>
 
 namespace GE::P2D::Box2D {
 
 class GE_API World: public GE::P2D::World
 {
 public:
-    explicit World(const Vec2& gravity);
+    World(const Vec2& gravity, const thread_config_t& threads);
     ~World();
 
     void step(Timestamp ts, int32_t sub_step_count) override;
 
+    const std::vector<body_move_event_t>& bodyMoveEvents() const override
+    {
+        return m_body_move_events;
+    }
+
+    const contact_events_t& contactEvents() const override { return m_contact_events; }
+
+    cast_hit_t castRayClosest(const ray_cast_t& ray) const override;
+    void castRay(const ray_cast_t& ray, std::vector<cast_hit_t>* hits) const override;
+    cast_hit_t castShape(const box_cast_t& cast) const override;
+    cast_hit_t castShape(const circle_cast_t& cast) const override;
+    void overlap(const aabb_overlap_t& query, std::vector<uint64_t>* user_data) const override;
+    void overlap(const box_overlap_t& query, std::vector<uint64_t>* user_data) const override;
+    void overlap(const circle_overlap_t& query, std::vector<uint64_t>* user_data) const override;
+
+    void castRaysClosest(std::span<const ray_cast_t> rays, std::span<cast_hit_t> hits) override;
+    void overlap(std::span<const aabb_overlap_t>  queries,
+                 std::span<std::vector<uint64_t>> user_data) override;
+
     Scoped<P2D::RigidBody> createRigidBody(RigidBody::Type type,
                                            const Vec2&     position,
-                                           float           angle) override;
+                                           float           angle,
+                                           uint64_t        user_data) override;
+    std::vector<Scoped<P2D::RigidBody>> createRigidBodies(
+        std::span<const body_def_t>         bodies,
+        std::span<const box_shape_def_t>    boxes,
+        std::span<const circle_shape_def_t> circles) override;
 
 private:
-    b2WorldId m_world{b2_nullWorldId};
+    static void* enqueueTask(b2TaskCallback* task,
+                             int32_t         item_count,
+                             int32_t         min_range,
+                             void*           task_context,
+                             void*           user_context);
+    static void finishTask(void* user_task, void* user_context);
+
+    template<typename Query>
+    void runBatch(size_t query_count, Query&& query);
+
+    void collectBodyMoveEvents();
+    void collectContactEvents();
+    void collectSensorEvents();
+
+    Scoped<JobSystem>              m_jobs;
+    b2WorldId                      m_world{b2_nullWorldId};
+    std::vector<body_move_event_t> m_body_move_events;
+    contact_events_t               m_contact_events;
+    std::vector<b2BodyId>          m_created_bodies;
 };
 
 } // namespace GE::P2D::Box2D
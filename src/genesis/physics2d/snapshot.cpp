@@ -0,0 +1,125 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2024, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "snapshot.h"
+#include "rigid_body.h"
+
+#include "genesis/core/log.h"
+
+#include <cstring>
+
+namespace GE::P2D {
+namespace {
+
+constexpr uint32_t SNAPSHOT_MAGIC{0x53443247}; // "G2DS"
+constexpr uint32_t SNAPSHOT_VERSION{2};
+
+struct header_t {
+    uint32_t magic{SNAPSHOT_MAGIC};
+    uint32_t version{SNAPSHOT_VERSION};
+    uint32_t body_count{0};
+};
+
+// Packed by hand, so a body takes 29 bytes instead of a padded struct
+constexpr size_t BODY_RECORD_SIZE{7 * sizeof(float) + sizeof(uint8_t)};
+
+template<typename T>
+void write(uint8_t** data, const T& value)
+{
+    std::memcpy(*data, &value, sizeof(T));
+    *data += sizeof(T);
+}
+
+template<typename T>
+T read(const uint8_t** data)
+{
+    T value{};
+    std::memcpy(&value, *data, sizeof(T));
+    *data += sizeof(T);
+    return value;
+}
+
+} // namespace
+
+void saveSnapshot(std::span<const RigidBody* const> bodies, std::vector<uint8_t>* snapshot)
+{
+    snapshot->resize(sizeof(header_t) + bodies.size() * BODY_RECORD_SIZE);
+
+    auto* data = snapshot->data();
+    write(&data, header_t{.body_count = static_cast<uint32_t>(bodies.size())});
+
+    for (const auto* body : bodies) {
+        auto state = body->state();
+        write(&data, state.position.x);
+        write(&data, state.position.y);
+        write(&data, state.rotation.x);
+        write(&data, state.rotation.y);
+        write(&data, state.linear_velocity.x);
+        write(&data, state.linear_velocity.y);
+        write(&data, state.angular_velocity);
+        write(&data, static_cast<uint8_t>(state.is_awake));
+    }
+}
+
+bool restoreSnapshot(std::span<RigidBody* const> bodies, std::span<const uint8_t> snapshot)
+{
+    if (snapshot.size() != sizeof(header_t) + bodies.size() * BODY_RECORD_SIZE) {
+        GE_CORE_ERR("Physics snapshot size doesn't match {} bodies", bodies.size());
+        return false;
+    }
+
+    const auto* data = snapshot.data();
+
+    if (auto header = read<header_t>(&data); header.magic != SNAPSHOT_MAGIC ||
+                                             header.version != SNAPSHOT_VERSION ||
+                                             header.body_count != bodies.size()) {
+        GE_CORE_ERR("Invalid physics snapshot header");
+        return false;
+    }
+
+    for (auto* body : bodies) {
+        body_state_t state;
+        state.position.x = read<float>(&data);
+        state.position.y = read<float>(&data);
+        state.rotation.x = read<float>(&data);
+        state.rotation.y = read<float>(&data);
+        state.linear_velocity.x = read<float>(&data);
+        state.linear_velocity.y = read<float>(&data);
+        state.angular_velocity = read<float>(&data);
+        state.is_awake = read<uint8_t>(&data) != 0;
+        body->setState(state);
+    }
+
+    return true;
+}
+
+} // namespace GE::P2D
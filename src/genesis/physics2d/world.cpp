@@ -35,9 +35,9 @@
 
 namespace GE::P2D {
 
-Scoped<World> World::create(const Vec2& gravity)
+Scoped<World> World::create(const Vec2& gravity, const thread_config_t& threads)
 {
-    return makeScoped<Box2D::World>(gravity);
+    return makeScoped<Box2D::World>(gravity, threads);
 }
 
 } // namespace GE::P2D
@@ -0,0 +1,284 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2024, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "command_buffer.h"
+#include "components/relationship_components.h"
+#include "components/transform_component.h"
+#include "entity_node.h"
+#include "scene.h"
+
+#include "genesis/core/asserts.h"
+
+#include <algorithm>
+#include <iterator>
+
+namespace GE::Scene {
+namespace {
+
+constexpr std::string_view DEFAULT_ENTITY_NAME{"Entity"};
+
+Entity::NativeHandle handleAt(std::span<const Entity::NativeHandle> entities, size_t index)
+{
+    if (index >= entities.size()) {
+        return Entity::NULL_ID;
+    }
+
+    return entities[index];
+}
+
+// The entities are chained after the scene tail, so the whole chain takes one node insertion
+std::vector<Entity::NativeHandle> createEntities(Scene* scene, std::span<const TagComponent> tags)
+{
+    auto entities = scene->createEntities(tags.size());
+    if (entities.empty()) {
+        return entities;
+    }
+
+    auto                            tail = scene->tailEnity();
+    std::vector<NodeComponent>      nodes(entities.size());
+    std::vector<TransformComponent> transforms(entities.size());
+
+    for (size_t i{0}; i < entities.size(); i++) {
+        nodes[i].prev_node = i > 0 ? entities[i - 1] : tail.nativeHandle();
+        nodes[i].next_node = handleAt(entities, i + 1);
+    }
+
+    scene->insertComponents<TagComponent>(entities, tags);
+    scene->insertComponents<TransformComponent>(entities, transforms);
+    scene->insertComponents<NodeComponent>(entities, nodes);
+
+    if (tail.isNull()) {
+        scene->entity(entities.front()).add<HeadNodeComponent>();
+    } else {
+        tail.get<NodeComponent>().next_node = entities.front();
+        tail.remove<TailNodeComponent>();
+    }
+
+    scene->entity(entities.back()).add<TailNodeComponent>();
+    return entities;
+}
+
+void reparentEntity(Scene*               scene,
+                    Entity::NativeHandle entity_handle,
+                    Entity::NativeHandle parent_handle)
+{
+    if (!scene->isValid(entity_handle) ||
+        (parent_handle != Entity::NULL_ID && !scene->isValid(parent_handle))) {
+        return;
+    }
+
+    auto entity = scene->entity(entity_handle);
+
+    if (parent_handle != Entity::NULL_ID) {
+        auto parent = scene->entity(parent_handle);
+        GE_CORE_ASSERT(!EntityNode{entity}.hasChild(parent) && entity != parent,
+                       "Unable to move an entity into its own subtree");
+        EntityNode{parent}.appendChild(entity);
+        return;
+    }
+
+    if (auto tail = scene->tailEnity(); tail != entity) {
+        EntityNode{tail}.insert(entity);
+    }
+}
+
+void collectSubtree(const EntityNode& root, std::vector<Entity::NativeHandle>* entities)
+{
+    entities->push_back(root.entity().nativeHandle());
+
+    std::vector<EntityNode> nodes;
+    if (root.hasChildNode()) {
+        nodes.push_back(root.childNode());
+    }
+
+    while (!nodes.empty()) {
+        auto node = nodes.back();
+        nodes.pop_back();
+
+        entities->push_back(node.entity().nativeHandle());
+
+        if (node.hasNextNode()) {
+            nodes.push_back(node.nextNode());
+        }
+
+        if (node.hasChildNode()) {
+            nodes.push_back(node.childNode());
+        }
+    }
+}
+
+// The subtrees are ejected from the entity tree first, then all entities are destroyed in bulk
+void destroyEntities(Scene* scene, std::span<const Entity::NativeHandle> roots)
+{
+    std::vector<Entity::NativeHandle> entities;
+
+    for (auto root : roots) {
+        if (!scene->isValid(root)) {
+            continue;
+        }
+
+        EntityNode node{scene->entity(root)};
+        node.eject();
+        collectSubtree(node, &entities);
+    }
+
+    std::sort(entities.begin(), entities.end());
+    entities.erase(std::unique(entities.begin(), entities.end()), entities.end());
+
+    scene->destroyEntities(entities);
+}
+
+} // namespace
+
+CommandBuffer::CommandBuffer() = default;
+
+CommandBuffer::~CommandBuffer() = default;
+
+CommandBuffer::CommandBuffer(CommandBuffer&& other) noexcept = default;
+
+CommandBuffer& CommandBuffer::operator=(CommandBuffer&& other) noexcept = default;
+
+CommandBuffer::entity_ref_t CommandBuffer::createEntity(std::string_view name)
+{
+    entity_ref_t entity;
+    entity.pending = static_cast<uint32_t>(m_created.size());
+
+    m_created.emplace_back(!name.empty() ? name : DEFAULT_ENTITY_NAME);
+    return entity;
+}
+
+void CommandBuffer::destroyEntity(const entity_ref_t& entity)
+{
+    m_destroyed.push_back(entity);
+}
+
+void CommandBuffer::reparent(const entity_ref_t& entity, const entity_ref_t& parent)
+{
+    m_reparented.push_back({entity, parent});
+}
+
+bool CommandBuffer::empty() const
+{
+    return m_created.empty() && m_destroyed.empty() && m_reparented.empty() &&
+           std::all_of(m_components.cbegin(), m_components.cend(),
+                       [](const auto& commands) { return commands.second->empty(); });
+}
+
+// The component commands keep their storage, so a buffer recorded every frame stops allocating
+void CommandBuffer::clear()
+{
+    m_created.clear();
+    m_destroyed.clear();
+    m_reparented.clear();
+
+    for (auto& [type, commands] : m_components) {
+        commands->clear();
+    }
+}
+
+void CommandBuffer::playback(Scene* scene)
+{
+    playback(scene, std::span{this, 1});
+}
+
+void CommandBuffer::playback(Scene* scene, std::span<CommandBuffer> buffers)
+{
+    std::vector<TagComponent> tags;
+
+    for (auto& buffer : buffers) {
+        std::move(buffer.m_created.begin(), buffer.m_created.end(), std::back_inserter(tags));
+    }
+
+    auto   created = createEntities(scene, tags);
+    size_t first_created{0};
+
+    for (auto& buffer : buffers) {
+        buffer.resolve(std::span{created}.subspan(first_created, buffer.m_created.size()));
+        first_created += buffer.m_created.size();
+    }
+
+    std::map<entt::id_type, std::vector<ICommands*>> batches;
+
+    for (auto& buffer : buffers) {
+        for (auto& [type, commands] : buffer.m_components) {
+            if (!commands->empty()) {
+                batches[type].push_back(commands.get());
+            }
+        }
+    }
+
+    for (auto& [type, batch] : batches) {
+        batch.front()->playback(scene, batch);
+    }
+
+    std::vector<Entity::NativeHandle> destroyed;
+
+    for (const auto& buffer : buffers) {
+        for (const auto& [entity, parent] : buffer.m_reparented) {
+            reparentEntity(scene, entity.handle, parent.handle);
+        }
+
+        for (const auto& entity : buffer.m_destroyed) {
+            destroyed.push_back(entity.handle);
+        }
+    }
+
+    destroyEntities(scene, destroyed);
+
+    for (auto& buffer : buffers) {
+        buffer.clear();
+    }
+}
+
+void CommandBuffer::resolve(std::span<const Entity::NativeHandle> created)
+{
+    for (auto& entity : m_destroyed) {
+        entity.handle = resolve(entity, created);
+    }
+
+    for (auto& [entity, parent] : m_reparented) {
+        entity.handle = resolve(entity, created);
+        parent.handle = resolve(parent, created);
+    }
+
+    for (auto& [type, commands] : m_components) {
+        commands->resolve(created);
+    }
+}
+
+Entity::NativeHandle CommandBuffer::resolve(const entity_ref_t&                   entity,
+                                            std::span<const Entity::NativeHandle> created)
+{
+    return entity.pending != NONE ? created[entity.pending] : entity.handle;
+}
+
+} // namespace GE::Scene
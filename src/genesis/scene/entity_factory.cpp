@@ -57,10 +57,10 @@ Entity EntityFactory::createSquare(std::string_view name)
 {
     auto entity = m_scene->createEntity(name);
 
-    auto& sprite = entity.add<SpriteComponent>();
-    sprite.setMeshID({"genesis", Assets::Group::MESHES, "square"});
-    sprite.setTextureID({"genesis", Assets::Group::TEXTURES, "square"});
-    sprite.loadAll(m_assets);
+    const auto& resources = entity.add<SpriteResourcesComponent>(
+        Assets::ResourceID{"genesis", Assets::Group::TEXTURES, "square"},
+        Assets::ResourceID{"genesis", Assets::Group::MESHES, "square"});
+    resources.loadAll(&entity.add<SpriteComponent>(), m_assets);
 
     auto& material = entity.add<MaterialComponent>();
     material.setMaterialID({"genesis", Assets::Group::PIPELINES, "sprite"});
@@ -73,10 +73,10 @@ Entity EntityFactory::createCircle(std::string_view name)
 {
     auto entity = m_scene->createEntity(name);
 
-    auto& sprite = entity.add<SpriteComponent>();
-    sprite.setMeshID({"genesis", Assets::Group::MESHES, "circle"});
-    sprite.setTextureID({"genesis", Assets::Group::TEXTURES, "circle"});
-    sprite.loadAll(m_assets);
+    const auto& resources = entity.add<SpriteResourcesComponent>(
+        Assets::ResourceID{"genesis", Assets::Group::TEXTURES, "circle"},
+        Assets::ResourceID{"genesis", Assets::Group::MESHES, "circle"});
+    resources.loadAll(&entity.add<SpriteComponent>(), m_assets);
 
     auto& material = entity.add<MaterialComponent>();
     material.setMaterialID({"genesis", Assets::Group::PIPELINES, "sprite"});
@@ -78,6 +78,7 @@ EntityNode EntityNode::insert(const Entity& entity)
 
     node().next_node = entity.nativeHandle();
     moveTailToNextNode();
+    inserted_entity.notifyParentChanged();
     return inserted_entity;
 }
 
@@ -96,6 +97,7 @@ EntityNode EntityNode::appendChild(const Entity& child_entity)
     child_node.eject();
     child_node.node().parent_node = m_entity.nativeHandle();
     node().child_node = child_entity.nativeHandle();
+    child_node.notifyParentChanged();
     return child_node;
 }
 
@@ -245,6 +247,12 @@ void EntityNode::eject()
     node().parent_node = Entity::NULL_ID;
 }
 
+// The links are written through get(), only a parent change is patched for the registry observers
+void EntityNode::notifyParentChanged()
+{
+    m_entity.patch<NodeComponent>();
+}
+
 NodeComponent& EntityNode::node()
 {
     GE_CORE_ASSERT(!isNull(), "Entity cannot be Null");
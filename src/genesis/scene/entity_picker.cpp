@@ -34,14 +34,17 @@
 #include "camera/view_projection_camera.h"
 #include "components.h"
 #include "entity.h"
-#include "renderer/renderer_base.h"
 #include "scene.h"
 
 #include "genesis/assets/resource_id.h"
 #include "genesis/graphics/framebuffer.h"
 #include "genesis/graphics/pipeline_config.h"
+#include "genesis/graphics/renderer.h"
 #include "genesis/graphics/shader.h"
-#include "genesis/graphics/staging_buffer.h"
+#include "genesis/math/linear.h"
+#include "genesis/math/transform.h"
+
+#include <cstring>
 
 namespace GE::Scene {
 namespace {
@@ -64,71 +67,54 @@ EntityPicker::EntityPicker(Scene*                      scene,
                            const Assets::Registry&     assets,
                            const ViewProjectionCamera* camera)
     : m_scene{scene}
+    , m_assets{&assets}
     , m_camera{camera}
-    , m_entity_id_buffer{StagingBuffer::create()}
 {
-    recreateEntityIdFramebuffer(camera->viewport());
+    createEntityIdFramebuffer();
     createEntityIdPipeline(assets);
 }
 
 EntityPicker::~EntityPicker() = default;
 
-void EntityPicker::onRender()
+void EntityPicker::pickEntity(const Vec2& position, PickCallback callback)
 {
-    auto* renderer = m_entity_id_fbo->renderer();
-    renderer->beginFrame(Renderer::CLEAR_ALL);
-    m_scene->forEach<SpriteComponent>([this](const auto& entity) { renderEntityId(entity); });
-    renderer->endFrame();
-    renderer->swapBuffers();
+    if (!isPositionInBounds(position, m_camera->viewport())) {
+        GE_CORE_ERR("Incorrect mouse position, mouse position={}, viewport={}",
+                    GE::toString(position), GE::toString(m_camera->viewport()));
+        callback({});
+        return;
+    }
 
-    m_is_buffer_updated = false;
+    renderPickRegion(position, std::move(callback));
 }
 
-void EntityPicker::onViewportUpdate(const Vec2& viewport)
+void EntityPicker::poll()
 {
-    if (m_entity_id_fbo->size() != viewport) {
-        recreateEntityIdFramebuffer(viewport);
-    }
+    m_entity_id_fbo->renderer()->pollReadbacks();
 }
 
-Entity EntityPicker::getEntityByPosition(const Vec2& position)
+std::vector<Entity> EntityPicker::getEntitiesInRect(const Vec2& first_corner,
+                                                    const Vec2& second_corner) const
 {
-    auto texture_size = m_entity_id_fbo->colorTexture(0).size();
-
-    if (!isPositionInBounds(position, texture_size)) {
-        GE_CORE_ERR("Incorrect mouse position, mouse position={}, texture size={}",
-                    GE::toString(position), GE::toString(texture_size));
-        return {};
-    }
+    auto first_position = toWorldPosition(first_corner);
+    auto second_position = toWorldPosition(second_corner);
 
-    if (!m_is_buffer_updated) {
-        m_entity_id_fbo->colorTexture(0).copyTo(m_entity_id_buffer.get());
-        m_is_buffer_updated = true;
-    }
-
-    void* texture = m_entity_id_buffer->data();
-    if (texture == nullptr) {
-        GE_CORE_ERR("Failed to get texture data");
-        return {};
-    }
+    aabb_t rect{};
+    rect.expand(first_position);
+    rect.expand(second_position);
 
-    Vec2 inverted_position = {position.x, texture_size.y - position.y - 1};
+    std::vector<Entity> entities;
+    m_scene->spatialIndex().query(rect, [this, &entities](auto entity_handle) {
+        entities.push_back(m_scene->entity(entity_handle));
+    });
 
-    const auto* pixels = static_cast<const int32_t*>(texture);
-    size_t      index = (inverted_position.y * texture_size.x) + inverted_position.x;
-    int32_t     entity_id = pixels[index];
-
-    if (entity_id == ENTITY_ID_NONE) {
-        return {};
-    }
-
-    return m_scene->entity(static_cast<Entity::NativeHandle>(entity_id));
+    return entities;
 }
 
-void EntityPicker::recreateEntityIdFramebuffer(const Vec2& size)
+void EntityPicker::createEntityIdFramebuffer()
 {
     Framebuffer::config_t config{};
-    config.size = size;
+    config.size = PICK_REGION_SIZE;
     config.msaa_samples = 1;
     config.attachments = {
         // Entity ID attachment
@@ -164,12 +150,43 @@ void EntityPicker::createEntityIdPipeline(const Assets::Registry& assets)
     GE_CORE_ASSERT(m_entity_id_pipeline, "Failed to create entity ID pipeline");
 }
 
-void EntityPicker::renderEntityId(const Entity& entity)
+void EntityPicker::renderPickRegion(const Vec2& position, PickCallback callback)
 {
+    auto view_projection = pickRegionViewProjection(position);
+    auto frustum = frustum_t::fromViewProjection(view_projection);
+
+    auto* renderer = m_entity_id_fbo->renderer();
+    renderer->beginFrame(Renderer::CLEAR_ALL);
+    m_scene->spatialIndex().queryFrustum(frustum, [this, &view_projection](auto entity_handle) {
+        renderEntityId(view_projection, m_scene->entity(entity_handle));
+    });
+    // The framebuffer and its readbacks are owned by the picker, so the callback can't outlive it.
+    // The entity might have been destroyed by the time the region is read back.
+    renderer->enqueueReadback(
+        m_entity_id_fbo->colorTexture(0), Vec2{0.0f}, PICK_REGION_SIZE,
+        [this, callback = std::move(callback)](const void* data, uint32_t size) {
+            int32_t entity_id{ENTITY_ID_NONE};
+            if (size >= sizeof(int32_t)) {
+                std::memcpy(&entity_id, data, sizeof(int32_t));
+            }
+
+            callback(entity_id != ENTITY_ID_NONE
+                         ? m_scene->entity(static_cast<Entity::NativeHandle>(entity_id))
+                         : Entity{});
+        });
+    renderer->endFrame();
+    renderer->swapBuffers();
+}
+
+void EntityPicker::renderEntityId(const Mat4& view_projection, const Entity& entity)
+{
+    auto* mesh = m_assets->resolve(entity.get<SpriteComponent>().mesh);
+    if (mesh == nullptr) {
+        return;
+    }
+
     auto* pipeline = m_entity_id_pipeline.get();
-    auto* mesh = entity.get<SpriteComponent>().mesh.get();
-    auto  mvp = m_camera->viewProjection() * parentTransform(entity) *
-               entity.get<TransformComponent>().transform();
+    auto  mvp = view_projection * m_scene->spatialIndex().worldTransform(entity.nativeHandle());
 
     auto* cmd = m_entity_id_fbo->renderer()->command();
     cmd->bind(pipeline);
@@ -178,4 +195,35 @@ void EntityPicker::renderEntityId(const Entity& entity)
     cmd->draw(*mesh);
 }
 
+Mat4 EntityPicker::pickRegionViewProjection(const Vec2& position) const
+{
+    // Stretch the region around the cursor over the whole entity ID framebuffer
+    auto viewport = m_camera->viewport();
+    Vec2 center{position.x + 0.5f, viewport.y - position.y - 0.5f};
+    Vec2 region_scale{viewport / PICK_REGION_SIZE};
+    Vec2 region_offset{(viewport - (2.0f * center)) / PICK_REGION_SIZE};
+
+    auto pick_matrix = GE::translate(Mat4{1.0f}, Vec3{region_offset, 0.0f}) *
+                       GE::scale(Vec3{region_scale, 1.0f});
+    return pick_matrix * m_camera->viewProjection();
+}
+
+Vec3 EntityPicker::toWorldPosition(const Vec2& position) const
+{
+    auto viewport = m_camera->viewport();
+    Vec2 ndc{(2.0f * position.x / viewport.x) - 1.0f, 1.0f - (2.0f * position.y / viewport.y)};
+
+    auto inverse_vp = inverse(m_camera->viewProjection());
+    auto near_point = inverse_vp * Vec4{ndc, 0.0f, 1.0f};
+    auto far_point = inverse_vp * Vec4{ndc, 1.0f, 1.0f};
+    Vec3 ray_origin = Vec3{near_point} / near_point.w;
+    Vec3 ray_end = Vec3{far_point} / far_point.w;
+
+    if (auto direction = ray_end - ray_origin; std::abs(direction.z) > 0.0f) {
+        return ray_origin + (direction * (-ray_origin.z / direction.z));
+    }
+
+    return ray_origin;
+}
+
 } // namespace GE::Scene
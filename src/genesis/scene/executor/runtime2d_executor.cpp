@@ -38,63 +38,146 @@
 #include "scene.h"
 #include "scene_serializer.h"
 
+#include "genesis/core/asserts.h"
 #include "genesis/math/types.h"
 #include "genesis/physics2d/rigid_body.h"
+#include "genesis/physics2d/snapshot.h"
 #include "genesis/physics2d/world.h"
 #include "glm/gtc/matrix_inverse.hpp"
 #include "renderer/renderer_base.h"
 
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
 namespace GE::Scene {
 namespace {
 
 constexpr int32_t SUB_STEP_COUNT{4};
 
-Mat4 entityTransform(const Entity& entity)
+P2D::pose_t interpolate(const P2D::pose_t& previous, const P2D::pose_t& current, float alpha)
 {
-    return entity.get<TransformComponent>().transform();
+    constexpr float TWO_PI{2.0f * std::numbers::pi_v<float>};
+
+    // Take the shortest arc, so a body crossing the +-pi boundary doesn't spin backwards
+    float angle_delta = std::remainder(current.angle - previous.angle, TWO_PI);
+
+    return {previous.position + (current.position - previous.position) * alpha,
+            previous.angle + angle_delta * alpha};
 }
 
-Mat4 rigidBodyTransform(const P2D::RigidBody& rigid_body)
+Mat4 rigidBodyTransform(const RigidBody2DComponent& rigid_body, float alpha)
 {
-    return makeTransform2D(rigid_body.position(), rigid_body.angle());
+    auto pose = interpolate(rigid_body.previous_pose, rigid_body.current_pose, alpha);
+    return makeTransform2D(pose.position, pose.angle);
 }
 
-void updateTransform(Entity* entity, const Mat4& parent_transform)
+void updateTransform(Entity* entity, const Mat4& parent_transform, float alpha)
 {
-    const auto& rigid_body = *entity->get<RigidBody2DComponent>().body;
-    auto        local_transform = affineInverse(parent_transform) * rigidBodyTransform(rigid_body);
+    const auto& rigid_body = entity->get<RigidBody2DComponent>();
+    auto        local_transform =
+        affineInverse(parent_transform) * rigidBodyTransform(rigid_body, alpha);
     auto [translation, rotation, scale] = decompose(local_transform);
 
-    auto& transform = entity->get<TransformComponent>();
-    transform.translation = translation;
-    transform.rotation = rotation;
+    entity->patch<TransformComponent>([&translation, &rotation](auto& transform) {
+        transform.translation = translation;
+        transform.rotation = rotation;
+    });
+}
+
+uint32_t hierarchyDepth(const Entity& entity)
+{
+    uint32_t depth{0};
+
+    for (auto node = EntityNode{entity}.parentNode(); !node.isNull(); node = node.parentNode()) {
+        depth++;
+    }
+
+    return depth;
+}
+
+uint64_t toUserData(Entity::NativeHandle entity)
+{
+    return static_cast<uint64_t>(entity);
+}
+
+Entity::NativeHandle toNativeHandle(uint64_t user_data)
+{
+    return static_cast<Entity::NativeHandle>(user_data);
+}
+
+struct body_batch_t {
+    std::vector<Entity::NativeHandle>    entities;
+    std::vector<P2D::body_def_t>         bodies;
+    std::vector<P2D::box_shape_def_t>    boxes;
+    std::vector<P2D::circle_shape_def_t> circles;
+};
+
+void appendBody(const Entity& entity, const Mat4& transform, body_batch_t* batch)
+{
+    auto [translation, rotation, scale] = decompose(transform);
+    auto body_index = static_cast<uint32_t>(batch->bodies.size());
+
+    const auto& rigid_body = entity.get<RigidBody2DComponent>();
+    batch->entities.push_back(entity.nativeHandle());
+    batch->bodies.push_back({rigid_body.body_type,
+                             {Vec2{translation}, rotation.z},
+                             rigid_body.fixed_rotation,
+                             toUserData(entity.nativeHandle())});
+
+    if (entity.has<CircleCollider2DComponent>()) {
+        float scale_max = std::max(scale.x, scale.y);
+
+        P2D::circle_body_shape_config_t circle_shape = entity.get<CircleCollider2DComponent>();
+        circle_shape.radius *= scale_max;
+        circle_shape.offset *= scale_max;
+        batch->circles.push_back({body_index, circle_shape});
+    } else if (entity.has<BoxCollider2DComponent>()) {
+        Vec2 scale_2d{scale};
+
+        P2D::box_body_shape_config_t box_shape = entity.get<BoxCollider2DComponent>();
+        box_shape.size *= scale_2d;
+        box_shape.center *= scale_2d;
+        batch->boxes.push_back({body_index, box_shape});
+    }
 }
 
+// World transforms are accumulated on the way down, so no body walks up to the root
 // NOLINTNEXTLINE(misc-no-recursion)
-void updateEntities(const EntityNode& node, const Mat4& parent_transform = Mat4{1.0f})
+void collectBodies(const EntityNode& node, const Mat4& parent_transform, body_batch_t* batch)
 {
-    auto current_entity = node;
+    auto current_node = node;
 
-    while (!current_entity.isNull()) {
-        if (current_entity.entity().has<RigidBody2DComponent>()) {
-            updateTransform(&current_entity.entity(), parent_transform);
+    while (!current_node.isNull()) {
+        const auto& entity = current_node.entity();
+        auto        transform = parent_transform * entity.get<TransformComponent>().transform();
+
+        if (entity.has<RigidBody2DComponent>()) {
+            appendBody(entity, transform, batch);
         }
 
-        if (current_entity.hasChildNode()) {
-            updateEntities(current_entity.childNode(),
-                           parent_transform * entityTransform(current_entity.entity()));
+        if (current_node.hasChildNode()) {
+            collectBodies(current_node.childNode(), transform, batch);
         }
 
-        current_entity = current_entity.nextNode();
+        current_node = current_node.nextNode();
     }
 }
 
 } // namespace
 
 Runtime2DExecutor::Runtime2DExecutor(Scene* scene, P2D::World* physics_world)
+    : Runtime2DExecutor{scene, physics_world, config_t{}}
+{}
+
+Runtime2DExecutor::Runtime2DExecutor(Scene*          scene,
+                                     P2D::World*     physics_world,
+                                     const config_t& config)
     : m_scene{scene}
     , m_world{physics_world}
+    , m_config{config}
 {
+    GE_CORE_ASSERT(m_config.step_rate > 0.0, "Physics step rate must be positive");
     initializePhysics2D();
 }
 
@@ -109,36 +192,59 @@ void Runtime2DExecutor::onUpdate(Timestamp timestamp)
         return;
     }
 
-    m_world->step(timestamp, SUB_STEP_COUNT);
-    updateEntities(EntityNode{m_scene->headEntity()});
+    Timestamp step{1.0 / m_config.step_rate};
+    m_accumulator += timestamp;
+
+    auto step_count = std::min(static_cast<uint32_t>(m_accumulator.sec() / step.sec()),
+                               m_config.max_steps_per_update);
+
+    // Bodies which moved during the previous update are interpolated again with the new alpha
+    m_updated_bodies = m_moving_bodies;
+    m_contact_events.clear();
+
+    for (uint32_t i{0}; i < step_count; i++) {
+        bool is_last_step = i + 1 == step_count;
+
+        // Only the pose before the last step is needed for interpolation
+        if (is_last_step) {
+            storePreviousPoses();
+            m_moving_bodies.clear();
+        }
+
+        m_world->step(step, SUB_STEP_COUNT);
+        m_accumulator -= step;
+        applyBodyMoveEvents(is_last_step);
+        appendContactEvents(m_world->contactEvents());
+    }
+
+    // A frame too long to catch up on drops the whole steps it couldn't simulate, so a single
+    // spike doesn't make every following frame run the maximum number of steps
+    if (m_accumulator.sec() >= step.sec()) {
+        m_accumulator = std::fmod(m_accumulator.sec(), step.sec());
+    }
+
+    m_interpolation_alpha = static_cast<float>(m_accumulator.sec() / step.sec());
+    updateTransforms();
 }
 
 void Runtime2DExecutor::initializePhysics2D()
 {
-    m_scene->forEach<RigidBody2DComponent>([this](Entity& entity) {
-        const auto& transform_component = entity.get<TransformComponent>();
-        auto        transform = parentTransform(entity) * transform_component.transform();
-        auto [translation, rotation, scale] = decompose(transform);
+    body_batch_t batch;
 
-        auto& rigid_body = entity.get<RigidBody2DComponent>();
-        rigid_body.body = m_world->createRigidBody(rigid_body.body_type, translation, rotation.z);
+    if (auto head = m_scene->headEntity(); !head.isNull()) {
+        collectBodies(EntityNode{head}, Mat4{1.0f}, &batch);
+    }
 
-        if (entity.has<CircleCollider2DComponent>()) {
-            float scale_max = std::max(scale.x, scale.y);
+    auto bodies = m_world->createRigidBodies(batch.bodies, batch.boxes, batch.circles);
 
-            auto circle_shape = entity.get<CircleCollider2DComponent>();
-            circle_shape.radius *= scale_max;
-            circle_shape.offset *= scale_max;
-            rigid_body.body->createShape(circle_shape);
-        } else if (entity.has<BoxCollider2DComponent>()) {
-            Vec2 scale_2d{scale};
+    for (size_t i{0}; i < bodies.size(); i++) {
+        auto& rigid_body = m_scene->entity(batch.entities[i]).get<RigidBody2DComponent>();
+        rigid_body.body = std::move(bodies[i]);
+        rigid_body.current_pose = batch.bodies[i].pose;
+        rigid_body.previous_pose = rigid_body.current_pose;
+    }
 
-            auto box_shape = entity.get<BoxCollider2DComponent>();
-            box_shape.size *= scale_2d;
-            box_shape.center *= scale_2d;
-            rigid_body.body->createShape(box_shape);
-        }
-    });
+    m_bodies = std::move(batch.entities);
 }
 
 void Runtime2DExecutor::resetRigidBody2D()
@@ -147,4 +253,113 @@ void Runtime2DExecutor::resetRigidBody2D()
         [](Entity& entity) { entity.get<RigidBody2DComponent>().body.reset(); });
 }
 
+void Runtime2DExecutor::saveSnapshot(std::vector<uint8_t>* snapshot) const
+{
+    std::vector<const P2D::RigidBody*> bodies;
+    bodies.reserve(m_bodies.size());
+
+    for (auto entity_handle : m_bodies) {
+        bodies.push_back(m_scene->entity(entity_handle).get<RigidBody2DComponent>().body.get());
+    }
+
+    P2D::saveSnapshot(bodies, snapshot);
+}
+
+bool Runtime2DExecutor::restoreSnapshot(std::span<const uint8_t> snapshot)
+{
+    std::vector<P2D::RigidBody*> bodies;
+    bodies.reserve(m_bodies.size());
+
+    for (auto entity_handle : m_bodies) {
+        bodies.push_back(m_scene->entity(entity_handle).get<RigidBody2DComponent>().body.get());
+    }
+
+    if (!P2D::restoreSnapshot(bodies, snapshot)) {
+        return false;
+    }
+
+    for (size_t i{0}; i < bodies.size(); i++) {
+        auto& rigid_body = m_scene->entity(m_bodies[i]).get<RigidBody2DComponent>();
+        rigid_body.current_pose = bodies[i]->pose();
+        rigid_body.previous_pose = rigid_body.current_pose;
+    }
+
+    m_accumulator = 0.0;
+    m_interpolation_alpha = 0.0f;
+    m_moving_bodies.clear();
+    m_updated_bodies = m_bodies;
+    updateTransforms();
+    return true;
+}
+
+void Runtime2DExecutor::storePreviousPoses()
+{
+    // Bodies which didn't move since the last update already have equal poses
+    for (auto entity_handle : m_updated_bodies) {
+        auto& rigid_body = m_scene->entity(entity_handle).get<RigidBody2DComponent>();
+        rigid_body.previous_pose = rigid_body.current_pose;
+    }
+}
+
+void Runtime2DExecutor::applyBodyMoveEvents(bool is_last_step)
+{
+    for (const auto& event : m_world->bodyMoveEvents()) {
+        auto entity_handle = toNativeHandle(event.user_data);
+        m_scene->entity(entity_handle).get<RigidBody2DComponent>().current_pose = event.pose;
+        m_updated_bodies.push_back(entity_handle);
+
+        if (is_last_step) {
+            m_moving_bodies.push_back(entity_handle);
+        }
+    }
+}
+
+void Runtime2DExecutor::appendContactEvents(const P2D::contact_events_t& events)
+{
+    for (const auto& event : events.begin_events) {
+        m_contact_events.begin_contacts.push_back(
+            {toNativeHandle(event.user_data_a), toNativeHandle(event.user_data_b)});
+    }
+
+    for (const auto& event : events.end_events) {
+        m_contact_events.end_contacts.push_back(
+            {toNativeHandle(event.user_data_a), toNativeHandle(event.user_data_b)});
+    }
+
+    for (const auto& event : events.hit_events) {
+        m_contact_events.hits.push_back({toNativeHandle(event.user_data_a),
+                                         toNativeHandle(event.user_data_b), event.point,
+                                         event.normal, event.approach_speed});
+    }
+
+    for (const auto& event : events.sensor_begin_events) {
+        m_contact_events.sensor_begins.push_back(
+            {toNativeHandle(event.sensor_user_data), toNativeHandle(event.visitor_user_data)});
+    }
+
+    for (const auto& event : events.sensor_end_events) {
+        m_contact_events.sensor_ends.push_back(
+            {toNativeHandle(event.sensor_user_data), toNativeHandle(event.visitor_user_data)});
+    }
+}
+
+void Runtime2DExecutor::updateTransforms()
+{
+    m_depth_sorted_bodies.clear();
+
+    for (auto entity_handle : m_updated_bodies) {
+        auto entity = m_scene->entity(entity_handle);
+        m_depth_sorted_bodies.emplace_back(hierarchyDepth(entity), entity_handle);
+    }
+
+    // A child's local transform depends on its parent's one, so parents are written first
+    std::sort(m_depth_sorted_bodies.begin(), m_depth_sorted_bodies.end());
+    auto last = std::unique(m_depth_sorted_bodies.begin(), m_depth_sorted_bodies.end());
+
+    for (auto it = m_depth_sorted_bodies.begin(); it != last; ++it) {
+        auto entity = m_scene->entity(it->second);
+        updateTransform(&entity, parentTransform(entity), m_interpolation_alpha);
+    }
+}
+
 } // namespace GE::Scene
@@ -0,0 +1,127 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2024, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "headless_runner.h"
+#include "components/physics2d_components.h"
+#include "executor/runtime2d_executor.h"
+#include "scene.h"
+#include "scene_deserializer.h"
+
+#include "genesis/core/hash.h"
+#include "genesis/core/job_system.h"
+
+#include <algorithm>
+
+namespace GE::Scene {
+namespace {
+
+uint64_t hashPose(uint64_t hash, const P2D::pose_t& pose)
+{
+    hash = fnvHash(hash, pose.position.x);
+    hash = fnvHash(hash, pose.position.y);
+    return fnvHash(hash, pose.angle);
+}
+
+} // namespace
+
+HeadlessRunner::HeadlessRunner(config_t config)
+    : m_config{std::move(config)}
+{}
+
+HeadlessRunner::report_t HeadlessRunner::run() const
+{
+    report_t report;
+    auto     load_start = Timestamp::now();
+
+    // Without an assets registry sprites and materials keep only their resource IDs
+    Scene scene;
+
+    if (SceneDeserializer deserializer{&scene, nullptr};
+        !deserializer.deserialize(m_config.scene_filepath)) {
+        return report;
+    }
+
+    report.is_loaded = true;
+    report.load_time = Timestamp::now() - load_start;
+
+    // Each tick runs exactly one physics step, so runs of the same scene are reproducible
+    auto              world = P2D::World::create(m_config.gravity, m_config.threads);
+    Runtime2DExecutor executor{&scene, world.get(), {m_config.tick_rate, 1}};
+    Timestamp         tick{1.0 / m_config.tick_rate};
+
+    for (uint32_t i{0}; i < m_config.tick_count; i++) {
+        auto tick_start = Timestamp::now();
+        executor.onUpdate(tick);
+        auto tick_time = Timestamp::now() - tick_start;
+
+        report.simulation_time += tick_time;
+        report.max_tick_time = std::max(report.max_tick_time.sec(), tick_time.sec());
+    }
+
+    report.tick_count = m_config.tick_count;
+    report.state_hash = stateHash(scene);
+    return report;
+}
+
+std::vector<HeadlessRunner::report_t>
+HeadlessRunner::runParallel(std::span<const config_t> configs, uint32_t thread_count)
+{
+    std::vector<report_t> reports(configs.size());
+    JobSystem             jobs{std::max(thread_count, 1U)};
+    JobSystem::Counter    counter;
+
+    jobs.parallelFor(
+        static_cast<uint32_t>(configs.size()), 1,
+        [configs, &reports](uint32_t begin, uint32_t end, uint32_t) {
+            for (uint32_t i{begin}; i < end; i++) {
+                reports[i] = HeadlessRunner{configs[i]}.run();
+            }
+        },
+        &counter);
+
+    jobs.wait(counter);
+    return reports;
+}
+
+uint64_t HeadlessRunner::stateHash(const Scene& scene)
+{
+    uint64_t hash{FNV_OFFSET_BASIS};
+
+    scene.forEach<RigidBody2DComponent>([&hash](const Entity& entity) {
+        hash = fnvHash(hash, entity.nativeHandle());
+        hash = hashPose(hash, entity.get<RigidBody2DComponent>().current_pose);
+    });
+
+    return hash;
+}
+
+} // namespace GE::Scene
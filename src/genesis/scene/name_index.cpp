@@ -0,0 +1,246 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2024, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "name_index.h"
+#include "components/tag_component.h"
+
+#include <algorithm>
+#include <cctype>
+#include <climits>
+
+namespace GE::Scene {
+
+void NameIndex::insert(NativeHandle entity, std::string_view name)
+{
+    if (auto slot = m_slots.find(entity); slot != m_slots.end()) {
+        if (auto* entry = &m_entries[slot->second]; entry->name != name) {
+            unlinkName(*entry);
+            retireGrams(*entry);
+            assignName(entry, name);
+            compactPostings();
+        }
+
+        return;
+    }
+
+    m_slots.emplace(entity, static_cast<uint32_t>(m_entries.size()));
+
+    auto& entry = m_entries.emplace_back();
+    entry.entity = entity;
+    assignName(&entry, name);
+}
+
+void NameIndex::remove(NativeHandle entity)
+{
+    auto slot = m_slots.find(entity);
+    if (slot == m_slots.end()) {
+        return;
+    }
+
+    auto index = slot->second;
+    m_slots.erase(slot);
+    unlinkName(m_entries[index]);
+    retireGrams(m_entries[index]);
+
+    if (index + 1 != m_entries.size()) {
+        m_entries[index] = std::move(m_entries.back());
+        m_slots[m_entries[index].entity] = index;
+    }
+
+    m_entries.pop_back();
+    compactPostings();
+}
+
+void NameIndex::clear()
+{
+    m_entries.clear();
+    m_slots.clear();
+    m_names.clear();
+    m_postings.clear();
+    m_posting_count = 0;
+    m_stale_posting_count = 0;
+}
+
+NameIndex::NativeHandle NameIndex::find(std::string_view name) const
+{
+    if (auto entities = m_names.find(name); entities != m_names.end()) {
+        return entities->second.front();
+    }
+
+    return Entity::NULL_ID;
+}
+
+std::span<const NameIndex::NativeHandle> NameIndex::findAll(std::string_view name) const
+{
+    if (auto entities = m_names.find(name); entities != m_names.end()) {
+        return entities->second;
+    }
+
+    return {};
+}
+
+void NameIndex::onComponentChanged(NativeHandle entity, const TagComponent& tag)
+{
+    insert(entity, tag.tag());
+}
+
+void NameIndex::assignName(entry_t* entry, std::string_view name)
+{
+    entry->name = name;
+    entry->folded_name = foldCase(name);
+    entry->stamp = ++m_stamp;
+
+    linkName(entry);
+    indexGrams(entry);
+}
+
+void NameIndex::linkName(entry_t* entry)
+{
+    auto& entities = m_names[entry->name];
+    entry->name_slot = static_cast<uint32_t>(entities.size());
+    entities.push_back(entry->entity);
+}
+
+void NameIndex::unlinkName(const entry_t& entry)
+{
+    auto  names = m_names.find(entry.name);
+    auto& entities = names->second;
+
+    if (entry.name_slot + 1 != entities.size()) {
+        auto moved_entity = entities.back();
+        entities[entry.name_slot] = moved_entity;
+        m_entries[m_slots.at(moved_entity)].name_slot = entry.name_slot;
+    }
+
+    entities.pop_back();
+
+    if (entities.empty()) {
+        m_names.erase(names);
+    }
+}
+
+void NameIndex::indexGrams(entry_t* entry)
+{
+    const auto& name = entry->folded_name;
+
+    std::vector<Gram> grams;
+    for (size_t gram_size{MIN_GRAM_SIZE}; gram_size <= MAX_GRAM_SIZE; gram_size++) {
+        for (size_t pos{0}; pos + gram_size <= name.size(); pos++) {
+            grams.push_back(makeGram(std::string_view{name}.substr(pos, gram_size)));
+        }
+    }
+
+    std::sort(grams.begin(), grams.end());
+    grams.erase(std::unique(grams.begin(), grams.end()), grams.end());
+
+    for (auto gram : grams) {
+        m_postings[gram].push_back({entry->entity, entry->stamp});
+    }
+
+    entry->gram_count = static_cast<uint32_t>(grams.size());
+    m_posting_count += grams.size();
+}
+
+void NameIndex::retireGrams(const entry_t& entry)
+{
+    // Postings are invalidated by the stamp and dropped in bulk by compactPostings()
+    m_stale_posting_count += entry.gram_count;
+}
+
+void NameIndex::compactPostings()
+{
+    if (m_stale_posting_count < MIN_STALE_POSTINGS ||
+        m_stale_posting_count < m_posting_count - m_stale_posting_count) {
+        return;
+    }
+
+    m_postings.clear();
+    m_posting_count = 0;
+    m_stale_posting_count = 0;
+
+    for (auto& entry : m_entries) {
+        indexGrams(&entry);
+    }
+}
+
+const NameIndex::entry_t* NameIndex::liveEntry(const posting_t& posting) const
+{
+    auto slot = m_slots.find(posting.entity);
+    if (slot == m_slots.end()) {
+        return nullptr;
+    }
+
+    const auto& entry = m_entries[slot->second];
+    return entry.stamp == posting.stamp ? &entry : nullptr;
+}
+
+const std::vector<NameIndex::posting_t>*
+NameIndex::rarestPostings(std::string_view folded_pattern) const
+{
+    const std::vector<posting_t>* rarest{nullptr};
+    auto gram_size = std::min(folded_pattern.size(), MAX_GRAM_SIZE);
+
+    for (size_t pos{0}; pos + gram_size <= folded_pattern.size(); pos++) {
+        auto postings = m_postings.find(makeGram(folded_pattern.substr(pos, gram_size)));
+        if (postings == m_postings.end()) {
+            return nullptr;
+        }
+
+        if (rarest == nullptr || postings->second.size() < rarest->size()) {
+            rarest = &postings->second;
+        }
+    }
+
+    return rarest;
+}
+
+std::string NameIndex::foldCase(std::string_view string)
+{
+    std::string folded(string);
+    std::transform(folded.begin(), folded.end(), folded.begin(),
+                   [](unsigned char symbol) { return static_cast<char>(std::tolower(symbol)); });
+    return folded;
+}
+
+NameIndex::Gram NameIndex::makeGram(std::string_view string)
+{
+    // The leading size keeps bigrams and trigrams apart
+    auto gram = static_cast<Gram>(string.size());
+
+    for (char symbol : string) {
+        gram = (gram << CHAR_BIT) | static_cast<uint8_t>(symbol);
+    }
+
+    return gram;
+}
+
+} // namespace GE::Scene
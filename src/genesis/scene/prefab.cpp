@@ -0,0 +1,267 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2024, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "prefab.h"
+#include "component_list.h"
+#include "components.h"
+#include "entity_node.h"
+#include "scene.h"
+#include "scene_deserializer.h"
+
+#include "genesis/assets/prefab_resource.h"
+#include "genesis/core/log.h"
+
+#include <algorithm>
+#include <type_traits>
+#include <unordered_map>
+
+namespace GE::Scene {
+namespace {
+
+template<typename T>
+T copyComponent(const T& component)
+{
+    return component;
+}
+
+template<>
+RigidBody2DComponent copyComponent(const RigidBody2DComponent& component)
+{
+    // The physics body belongs to a running world, every instance gets its own one on start
+    return {component.body_type, component.fixed_rotation};
+}
+
+} // namespace
+
+class Prefab::IComponents
+{
+public:
+    virtual ~IComponents() = default;
+
+    virtual void instantiate(Scene* scene, std::span<const Entity::NativeHandle> handles,
+                             size_t entity_count) const = 0;
+};
+
+template<typename T>
+class Prefab::Components: public IComponents
+{
+public:
+    void pack(uint32_t index, const T& component)
+    {
+        m_indices.push_back(index);
+        m_components.push_back(copyComponent(component));
+    }
+
+    bool empty() const { return m_indices.empty(); }
+
+    void instantiate(Scene* scene, std::span<const Entity::NativeHandle> handles,
+                     size_t entity_count) const override
+    {
+        std::vector<Entity::NativeHandle> targets(m_indices.size());
+
+        for (size_t first{0}; first < handles.size(); first += entity_count) {
+            std::ranges::transform(m_indices, targets.begin(), [&handles, first](uint32_t index) {
+                return handles[first + index];
+            });
+
+            if constexpr (std::is_copy_constructible_v<T>) {
+                scene->insertComponents<T>(targets, m_components);
+            } else {
+                for (size_t i{0}; i < targets.size(); ++i) {
+                    scene->entity(targets[i]).add<T>(copyComponent(m_components[i]));
+                }
+            }
+        }
+    }
+
+private:
+    std::vector<uint32_t> m_indices;
+    std::vector<T>        m_components;
+};
+
+Prefab::Prefab(const Scene& scene)
+{
+    if (auto head = scene.headEntity(); !head.isNull()) {
+        bake(EntityNode{head}, true);
+    }
+}
+
+Prefab::Prefab(const Entity& root)
+{
+    if (!root.isNull()) {
+        bake(EntityNode{root}, false);
+    }
+}
+
+Prefab::~Prefab() = default;
+
+Scoped<Prefab> Prefab::create(const Assets::PrefabResource& resource, Assets::Registry* assets)
+{
+    Scene scene;
+
+    if (!SceneDeserializer{&scene, assets}.deserialize(resource.description())) {
+        GE_CORE_ERR("Failed to bake the prefab '{}'", resource.id().asString());
+        return nullptr;
+    }
+
+    return makeScoped<Prefab>(scene);
+}
+
+std::vector<Entity> Prefab::instantiate(Scene* scene, uint32_t count, const Entity& parent) const
+{
+    if (m_links.empty() || count == 0) {
+        return {};
+    }
+
+    auto handles = scene->createEntities(m_links.size() * count);
+
+    for (const auto& components : m_components) {
+        components->instantiate(scene, handles, m_links.size());
+    }
+
+    insertNodes(scene, handles);
+
+    std::vector<Entity> roots;
+    roots.reserve(m_roots.size() * count);
+
+    auto previous = parent.isNull() ? scene->tailEnity() : EntityNode{parent}.lastChild().entity();
+
+    for (size_t first{0}; first < handles.size(); first += m_links.size()) {
+        for (auto root_index : m_roots) {
+            auto root = scene->entity(handles[first + root_index]);
+
+            if (!previous.isNull()) {
+                EntityNode{previous}.insert(root);
+            } else if (!parent.isNull()) {
+                EntityNode{parent}.appendChild(root);
+            } else {
+                root.add<HeadNodeComponent>();
+                root.add<TailNodeComponent>();
+            }
+
+            previous = root;
+            roots.push_back(root);
+        }
+    }
+
+    return roots;
+}
+
+// Entities are indexed depth first, so the links of every instance are the same index tables
+// remapped to its own handles
+void Prefab::bake(const EntityNode& first, bool with_siblings)
+{
+    std::vector<Entity>                                entities;
+    std::unordered_map<Entity::NativeHandle, uint32_t> indices;
+    std::vector<EntityNode>                            nodes{first};
+
+    while (!nodes.empty()) {
+        auto node = nodes.back();
+        nodes.pop_back();
+
+        bool is_first = entities.empty();
+        indices.emplace(node.entity().nativeHandle(), static_cast<uint32_t>(entities.size()));
+        entities.push_back(node.entity());
+
+        if (node.hasNextNode() && (with_siblings || !is_first)) {
+            nodes.push_back(node.nextNode());
+        }
+
+        if (node.hasChildNode()) {
+            nodes.push_back(node.childNode());
+        }
+    }
+
+    // Links leading out of a baked subtree are dropped along with the null ones
+    auto to_index = [&indices](Entity::NativeHandle handle) {
+        auto index = indices.find(handle);
+        return index != indices.end() ? index->second : NONE;
+    };
+
+    m_links.reserve(entities.size());
+
+    for (uint32_t index{0}; index < entities.size(); ++index) {
+        const auto& node = entities[index].get<NodeComponent>();
+        auto&       link = m_links.emplace_back(link_t{to_index(node.prev_node),
+                                                       to_index(node.next_node),
+                                                       to_index(node.child_node),
+                                                       to_index(node.parent_node)});
+
+        // Roots are linked into the target scene on instancing
+        if (link.parent == NONE) {
+            link.prev = NONE;
+            link.next = NONE;
+            m_roots.push_back(index);
+        }
+    }
+
+    forEachType<ComponentList>([this, &entities](const auto& type) {
+        using Component = std::decay_t<decltype(type)>;
+
+        auto components = makeScoped<Components<Component>>();
+
+        for (uint32_t index{0}; index < entities.size(); ++index) {
+            if (entities[index].has<Component>()) {
+                components->pack(index, entities[index].get<Component>());
+            }
+        }
+
+        if (!components->empty()) {
+            m_components.push_back(std::move(components));
+        }
+    });
+}
+
+void Prefab::insertNodes(Scene* scene, std::span<const Entity::NativeHandle> handles) const
+{
+    std::vector<NodeComponent> nodes;
+    nodes.reserve(handles.size());
+
+    for (size_t first{0}; first < handles.size(); first += m_links.size()) {
+        auto to_handle = [&handles, first](uint32_t index) -> Entity::NativeHandle {
+            if (index == NONE) {
+                return Entity::NULL_ID;
+            }
+
+            return handles[first + index];
+        };
+
+        for (const auto& link : m_links) {
+            nodes.push_back({to_handle(link.prev), to_handle(link.next), to_handle(link.child),
+                             to_handle(link.parent)});
+        }
+    }
+
+    scene->insertComponents<NodeComponent>(handles, nodes);
+}
+
+} // namespace GE::Scene
@@ -53,7 +53,7 @@ Entity Registry::create()
     return toEntity(m_registry.create());
 }
 
-Entity Registry::entity(EntityHandle entity_handle)
+Entity Registry::entity(EntityHandle entity_handle) const
 {
     if (m_registry.valid(entity_handle)) {
         return toEntity(entity_handle);
@@ -62,6 +62,11 @@ Entity Registry::entity(EntityHandle entity_handle)
     return {};
 }
 
+bool Registry::isValid(EntityHandle entity_handle) const
+{
+    return m_registry.valid(entity_handle);
+}
+
 void Registry::destroy(const Entity& entity)
 {
     destroy(entity.nativeHandle());
@@ -99,6 +104,18 @@ void Registry::eachEntity(const ForeachConstCallback& callback) const
     }
 }
 
+std::vector<Registry::EntityHandle> Registry::createMany(size_t count)
+{
+    std::vector<EntityHandle> entities(count);
+    m_registry.create(entities.begin(), entities.end());
+    return entities;
+}
+
+void Registry::destroyMany(std::span<const EntityHandle> entities)
+{
+    m_registry.destroy(entities.begin(), entities.end());
+}
+
 Entity Registry::toEntity(EntityHandle entity) const
 {
     return Entity::Factory::create(entity, &m_registry);
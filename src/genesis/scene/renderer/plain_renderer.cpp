@@ -40,22 +40,31 @@ namespace GE::Scene {
 
 void PlainRenderer::render(const Scene& scene)
 {
-    m_renderer->beginFrame();
+    updateVisibleEntities(scene);
+    m_render_queue.clear();
+
+    for (size_t i{0}; i < m_visible_entities.size(); ++i) {
+        const auto& entity = m_visible_entities[i];
+        if (!entity.has<MaterialComponent>()) {
+            continue;
+        }
 
-    scene.forEach<MaterialComponent, SpriteComponent>([this](const auto& entity) {
-        const auto& material = entity.template get<MaterialComponent>();
+        const auto& material = entity.get<MaterialComponent>();
         if (!m_pipeline_library.has(material.materialID())) {
             m_pipeline_library.add(material.materialID(),
                                    material.pipeline_resource->createPipeline(m_renderer));
         }
 
-        renderEntity(m_renderer, m_pipeline_library.get(material.materialID()).get(), entity);
-    });
+        pushEntity(RenderQueue::Pass::OPAQUE_ENTITIES,
+                   m_pipeline_library.get(material.materialID()).get(), i);
+    }
+
+    m_render_queue.sort();
+
+    m_renderer->beginFrame();
+    m_render_queue.submit(m_renderer, RenderQueue::Pass::OPAQUE_ENTITIES);
 
-    m_primitives_renderer.begin();
-    scene.forEach<RigidBody2DComponent>(
-        [this](const auto& entity) { renderCircleCollider2D(entity); });
-    m_primitives_renderer.end();
+    renderPhysics2DColliders(scene);
 
     m_renderer->endFrame();
 }
@@ -0,0 +1,393 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2024, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "renderer/render_graph.h"
+
+#include "genesis/core/asserts.h"
+#include "genesis/core/log.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace GE::Scene {
+namespace {
+
+constexpr uint32_t NO_PASS{std::numeric_limits<uint32_t>::max()};
+
+bool hasSameAttachments(const Framebuffer::config_t& lhs, const Framebuffer::config_t& rhs)
+{
+    auto is_same_attachment = [](const fb_attachment_t& lhs, const fb_attachment_t& rhs) {
+        return lhs.type == rhs.type && lhs.texture_type == rhs.texture_type &&
+               lhs.texture_format == rhs.texture_format && lhs.clear_color == rhs.clear_color &&
+               lhs.clear_depth == rhs.clear_depth;
+    };
+
+    return lhs.layers == rhs.layers && lhs.msaa_samples == rhs.msaa_samples &&
+           std::equal(lhs.attachments.begin(), lhs.attachments.end(), rhs.attachments.begin(),
+                      rhs.attachments.end(), is_same_attachment);
+}
+
+bool isCompatible(const Framebuffer::config_t& lhs, const Framebuffer::config_t& rhs)
+{
+    return lhs.size == rhs.size && hasSameAttachments(lhs, rhs);
+}
+
+} // namespace
+
+RenderGraph::ResourceID RenderGraph::createTarget(std::string                  name,
+                                                  const Framebuffer::config_t& config)
+{
+    m_resources.push_back({.name = std::move(name), .config = config});
+    m_is_compiled = false;
+    return m_resources.size() - 1;
+}
+
+RenderGraph::ResourceID RenderGraph::importTarget(std::string name, GE::Renderer* renderer)
+{
+    m_resources.push_back({.name = std::move(name), .imported_renderer = renderer});
+    m_is_compiled = false;
+    return m_resources.size() - 1;
+}
+
+void RenderGraph::setTargetSize(ResourceID target, const Vec2& size)
+{
+    GE_CORE_ASSERT(!isImported(target), "Unable to resize imported target '{}'",
+                   m_resources[target].name);
+
+    auto& config = m_resources[target].config;
+    if (config.size != size) {
+        config.size = size;
+        m_is_compiled = false;
+    }
+}
+
+void RenderGraph::addPass(std::string             name,
+                          ResourceID              target,
+                          std::vector<ResourceID> reads,
+                          Renderer::ClearMode     clear_mode,
+                          Execute                 execute)
+{
+    GE_CORE_ASSERT(target < m_resources.size(), "Pass '{}' writes unknown target", name);
+    m_passes.push_back({std::move(name), target, std::move(reads), clear_mode, std::move(execute)});
+    m_is_compiled = false;
+}
+
+bool RenderGraph::compile()
+{
+    for (uint32_t i{0}; i < m_passes.size(); i++) {
+        for (auto read : m_passes[i].reads) {
+            if (!isImported(read) && !hasProducer(read, i)) {
+                GE_CORE_ERR("Pass '{}' reads target '{}' before it is written", m_passes[i].name,
+                            m_resources[read].name);
+                return false;
+            }
+        }
+    }
+
+    sortPasses(cullPasses());
+    groupFrames();
+    assignPhysicalTargets();
+
+    m_is_compiled = true;
+    m_is_allocated = false;
+    return true;
+}
+
+void RenderGraph::execute()
+{
+    if (!m_is_compiled && !compile()) {
+        return;
+    }
+
+    for (const auto& frame : m_frames) {
+        auto* renderer = this->renderer(frame.target);
+
+        if (renderer->beginFrame(frame.clear_mode)) {
+            for (size_t i{frame.first}; i < frame.end; i++) {
+                m_passes[m_order[i]].execute(renderer, this);
+            }
+
+            renderer->endFrame();
+
+            if (!isImported(frame.target)) {
+                renderer->swapBuffers();
+            }
+        }
+    }
+}
+
+Framebuffer* RenderGraph::framebuffer(ResourceID target)
+{
+    if (isImported(target) || (!m_is_compiled && !compile()) || !m_resources[target].is_used) {
+        return nullptr;
+    }
+
+    if (!m_is_allocated) {
+        allocatePhysicalTargets();
+        m_is_allocated = true;
+    }
+
+    return m_physical_targets[m_resources[target].physical].framebuffer.get();
+}
+
+GE::Renderer* RenderGraph::renderer(ResourceID target)
+{
+    if (isImported(target)) {
+        return m_resources[target].imported_renderer;
+    }
+
+    auto* target_framebuffer = framebuffer(target);
+    return target_framebuffer != nullptr ? target_framebuffer->renderer() : nullptr;
+}
+
+std::vector<std::string_view> RenderGraph::executionOrder() const
+{
+    std::vector<std::string_view> names;
+    names.reserve(m_order.size());
+
+    for (auto pass_index : m_order) {
+        names.push_back(m_passes[pass_index].name);
+    }
+
+    return names;
+}
+
+std::optional<uint32_t> RenderGraph::physicalTarget(ResourceID target) const
+{
+    if (!m_is_compiled || isImported(target) || !m_resources[target].is_used) {
+        return {};
+    }
+
+    return m_resources[target].physical;
+}
+
+bool RenderGraph::isImported(ResourceID target) const
+{
+    return m_resources[target].imported_renderer != nullptr;
+}
+
+bool RenderGraph::hasProducer(ResourceID target, uint32_t pass_index) const
+{
+    return std::any_of(m_passes.begin(), m_passes.begin() + pass_index,
+                       [target](const auto& pass) { return pass.target == target; });
+}
+
+bool RenderGraph::dependsOn(const pass_t& pass, const pass_t& other) const
+{
+    auto reads = [](const pass_t& pass, ResourceID target) {
+        return std::find(pass.reads.begin(), pass.reads.end(), target) != pass.reads.end();
+    };
+
+    return pass.target == other.target || reads(pass, other.target) || reads(other, pass.target);
+}
+
+std::vector<bool> RenderGraph::cullPasses() const
+{
+    std::vector<bool> is_needed(m_resources.size(), false);
+    std::vector<bool> is_alive(m_passes.size(), false);
+
+    for (ResourceID i{0}; i < m_resources.size(); i++) {
+        is_needed[i] = isImported(i);
+    }
+
+    // A reader is always declared after its producers, so a single backward sweep is enough
+    for (auto i = static_cast<int64_t>(m_passes.size()) - 1; i >= 0; i--) {
+        const auto& pass = m_passes[i];
+        if (!is_needed[pass.target]) {
+            continue;
+        }
+
+        is_alive[i] = true;
+        for (auto read : pass.reads) {
+            is_needed[read] = true;
+        }
+    }
+
+    return is_alive;
+}
+
+void RenderGraph::sortPasses(const std::vector<bool>& is_alive)
+{
+    std::vector<uint32_t>              dependency_count(m_passes.size(), 0);
+    std::vector<std::vector<uint32_t>> dependents(m_passes.size());
+
+    for (uint32_t i{0}; i < m_passes.size(); i++) {
+        for (uint32_t j{0}; j < i && is_alive[i]; j++) {
+            if (is_alive[j] && dependsOn(m_passes[i], m_passes[j])) {
+                dependents[j].push_back(i);
+                dependency_count[i]++;
+            }
+        }
+    }
+
+    std::vector<bool> is_scheduled(m_passes.size(), false);
+    m_order.clear();
+
+    auto priority = [this](uint32_t pass_index) {
+        const auto& target = m_passes[pass_index].target;
+
+        if (!m_order.empty() && target == m_passes[m_order.back()].target) {
+            return 0;
+        }
+
+        return isImported(target) ? 2 : 1;
+    };
+
+    // Kahn's algorithm preferring the pass which continues the current target and then passes
+    // producing transient targets, so that the passes writing the same target end up adjacent
+    while (true) {
+        uint32_t next{NO_PASS};
+
+        for (uint32_t i{0}; i < m_passes.size(); i++) {
+            if (!is_alive[i] || is_scheduled[i] || dependency_count[i] > 0) {
+                continue;
+            }
+
+            if (next == NO_PASS || priority(i) < priority(next)) {
+                next = i;
+            }
+        }
+
+        if (next == NO_PASS) {
+            break;
+        }
+
+        is_scheduled[next] = true;
+        m_order.push_back(next);
+
+        for (auto dependent : dependents[next]) {
+            dependency_count[dependent]--;
+        }
+    }
+}
+
+void RenderGraph::groupFrames()
+{
+    m_frames.clear();
+
+    // Consecutive passes writing the same target share a single frame, so the target's layout
+    // transitions happen once per group instead of once per pass. Only a pass that loads the
+    // target can join the frame, a pass that clears it starts a new one.
+    for (size_t i{0}; i < m_order.size(); i++) {
+        const auto& pass = m_passes[m_order[i]];
+
+        if (!m_frames.empty() && m_frames.back().target == pass.target &&
+            pass.clear_mode == Renderer::CLEAR_NONE) {
+            m_frames.back().end = i + 1;
+            continue;
+        }
+
+        m_frames.push_back({pass.target, pass.clear_mode, i, i + 1});
+    }
+}
+
+void RenderGraph::assignPhysicalTargets()
+{
+    constexpr uint32_t NO_USE{std::numeric_limits<uint32_t>::max()};
+
+    std::vector<uint32_t> first_use(m_resources.size(), NO_USE);
+    std::vector<uint32_t> last_use(m_resources.size(), 0);
+
+    for (uint32_t position{0}; position < m_order.size(); position++) {
+        const auto& pass = m_passes[m_order[position]];
+
+        auto use = [&](ResourceID target) {
+            first_use[target] = std::min(first_use[target], position);
+            last_use[target] = std::max(last_use[target], position);
+        };
+
+        use(pass.target);
+        std::for_each(pass.reads.begin(), pass.reads.end(), use);
+    }
+
+    std::vector<ResourceID> transients;
+    for (ResourceID i{0}; i < m_resources.size(); i++) {
+        m_resources[i].is_used = !isImported(i) && first_use[i] != NO_USE;
+
+        if (m_resources[i].is_used) {
+            transients.push_back(i);
+        }
+    }
+
+    std::sort(transients.begin(), transients.end(),
+              [&first_use](auto lhs, auto rhs) { return first_use[lhs] < first_use[rhs]; });
+
+    // Transient targets with identical layouts and disjoint lifetimes share one framebuffer
+    std::vector<Framebuffer::config_t> configs;
+    std::vector<uint32_t>              busy_until;
+
+    for (auto target : transients) {
+        auto& resource = m_resources[target];
+        auto  physical = configs.size();
+
+        for (size_t i{0}; i < configs.size(); i++) {
+            if (busy_until[i] < first_use[target] && isCompatible(configs[i], resource.config)) {
+                physical = i;
+                break;
+            }
+        }
+
+        if (physical == configs.size()) {
+            configs.push_back(resource.config);
+            busy_until.push_back(0);
+        }
+
+        busy_until[physical] = last_use[target];
+        resource.physical = physical;
+    }
+
+    m_physical_targets.resize(configs.size());
+
+    for (size_t i{0}; i < configs.size(); i++) {
+        auto& physical_target = m_physical_targets[i];
+
+        if (physical_target.framebuffer != nullptr &&
+            !hasSameAttachments(physical_target.config, configs[i])) {
+            physical_target.framebuffer.reset();
+        }
+
+        physical_target.config = configs[i];
+    }
+}
+
+void RenderGraph::allocatePhysicalTargets()
+{
+    for (auto& physical_target : m_physical_targets) {
+        if (physical_target.framebuffer == nullptr) {
+            physical_target.framebuffer = Framebuffer::create(physical_target.config);
+        } else {
+            physical_target.framebuffer->resize(physical_target.config.size);
+        }
+    }
+}
+
+} // namespace GE::Scene
@@ -0,0 +1,213 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2024, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "renderer/render_queue.h"
+
+#include "genesis/graphics/index_buffer.h"
+#include "genesis/graphics/mesh.h"
+#include "genesis/graphics/render_command.h"
+#include "genesis/graphics/renderer.h"
+
+#include <algorithm>
+#include <array>
+#include <utility>
+
+namespace GE::Scene {
+namespace {
+
+constexpr uint32_t RADIX_BITS{8};
+constexpr size_t   RADIX_BUCKETS{1 << RADIX_BITS};
+constexpr uint64_t RADIX_MASK{RADIX_BUCKETS - 1};
+constexpr uint32_t KEY_BITS{64};
+
+constexpr uint32_t DEPTH_SHIFT{0};
+constexpr uint32_t MESH_SHIFT{DEPTH_SHIFT + RenderQueue::DEPTH_BITS};
+constexpr uint32_t TEXTURE_SHIFT{MESH_SHIFT + RenderQueue::MESH_BITS};
+constexpr uint32_t PIPELINE_SHIFT{TEXTURE_SHIFT + RenderQueue::TEXTURE_BITS};
+constexpr uint32_t PASS_SHIFT{PIPELINE_SHIFT + RenderQueue::PIPELINE_BITS};
+
+static_assert(PASS_SHIFT + RenderQueue::PASS_BITS == KEY_BITS);
+
+constexpr uint64_t bitMask(uint32_t bits)
+{
+    return (uint64_t{1} << bits) - 1;
+}
+
+uint64_t quantizeDepth(float depth)
+{
+    constexpr auto MAX_DEPTH = static_cast<float>(bitMask(RenderQueue::DEPTH_BITS));
+    return static_cast<uint64_t>(std::clamp(depth, 0.0f, 1.0f) * MAX_DEPTH);
+}
+
+float ndcDepth(const Mat4& mvp)
+{
+    const auto& origin = mvp[3];
+    return origin.w != 0.0f ? origin.z / origin.w : 0.0f;
+}
+
+} // namespace
+
+void RenderQueue::clear()
+{
+    m_items.clear();
+    m_keys.clear();
+
+    // Ids are kept between frames so that an unchanged scene produces the same keys and the
+    // sorted order can be reused. Saturated tables are reset and start numbering from scratch.
+    if (m_pipeline_ids.size() > bitMask(PIPELINE_BITS) ||
+        m_texture_ids.size() > bitMask(TEXTURE_BITS) || m_mesh_ids.size() > bitMask(MESH_BITS)) {
+        m_pipeline_ids.clear();
+        m_texture_ids.clear();
+        m_mesh_ids.clear();
+    }
+}
+
+void RenderQueue::push(Pass pass, const item_t& item)
+{
+    auto pipeline_id = resourceId(&m_pipeline_ids, item.pipeline, PIPELINE_BITS);
+    auto texture_id = resourceId(&m_texture_ids, item.texture, TEXTURE_BITS);
+    auto mesh_id = resourceId(&m_mesh_ids, item.mesh, MESH_BITS);
+
+    m_items.push_back(item);
+    m_keys.push_back(makeKey(pass, pipeline_id, texture_id, mesh_id, ndcDepth(item.mvp)));
+}
+
+void RenderQueue::sort()
+{
+    if (m_keys == m_cached_keys && m_order.size() == m_keys.size()) {
+        return;
+    }
+
+    radixSort();
+    m_cached_keys = m_keys;
+}
+
+void RenderQueue::submit(GE::Renderer* renderer, Pass pass) const
+{
+    auto*         cmd = renderer->command();
+    const item_t* bound{nullptr};
+
+    forEach(pass, [&](const item_t& item) {
+        bool pipeline_changed = bound == nullptr || bound->pipeline != item.pipeline;
+
+        if (pipeline_changed) {
+            cmd->bind(item.pipeline);
+        }
+
+        if (pipeline_changed || bound->texture != item.texture) {
+            cmd->bind(item.pipeline, "u_Sprite", *item.texture);
+        }
+
+        // The keys group the items by mesh within a texture, so the buffers are mostly bound once
+        // per run of the same mesh
+        if (bound == nullptr || bound->mesh != item.mesh) {
+            cmd->bind(item.mesh->vertexBuffer().get());
+            cmd->bind(item.mesh->indexBuffer().get());
+        }
+
+        cmd->pushConstant(item.pipeline, "pc.mvp", item.mvp);
+        cmd->drawIndexed(item.mesh->indexBuffer()->count());
+        bound = &item;
+    });
+}
+
+uint64_t RenderQueue::makeKey(Pass     pass,
+                              uint32_t pipeline_id,
+                              uint32_t texture_id,
+                              uint32_t mesh_id,
+                              float    depth)
+{
+    return (static_cast<uint64_t>(pass) << PASS_SHIFT) |
+           ((pipeline_id & bitMask(PIPELINE_BITS)) << PIPELINE_SHIFT) |
+           ((texture_id & bitMask(TEXTURE_BITS)) << TEXTURE_SHIFT) |
+           ((mesh_id & bitMask(MESH_BITS)) << MESH_SHIFT) | (quantizeDepth(depth) << DEPTH_SHIFT);
+}
+
+uint32_t RenderQueue::resourceId(IdMap* ids, const void* resource, uint32_t bits)
+{
+    auto [it, _] = ids->try_emplace(resource, static_cast<uint32_t>(ids->size()));
+    return std::min<uint64_t>(it->second, bitMask(bits));
+}
+
+std::pair<size_t, size_t> RenderQueue::range(Pass pass) const
+{
+    auto pass_end = std::partition_point(m_order.begin(), m_order.end(), [](const auto& entry) {
+        return (entry.key >> PASS_SHIFT) == static_cast<uint64_t>(Pass::OPAQUE_ENTITIES);
+    });
+    auto split = static_cast<size_t>(std::distance(m_order.begin(), pass_end));
+
+    if (pass == Pass::OPAQUE_ENTITIES) {
+        return {0, split};
+    }
+
+    return {split, m_order.size()};
+}
+
+void RenderQueue::radixSort()
+{
+    m_order.resize(m_keys.size());
+    m_scratch.resize(m_keys.size());
+
+    for (uint32_t i = 0; i < m_keys.size(); i++) {
+        m_order[i] = {m_keys[i], i};
+    }
+
+    if (m_order.empty()) {
+        return;
+    }
+
+    for (uint32_t shift = 0; shift < KEY_BITS; shift += RADIX_BITS) {
+        std::array<size_t, RADIX_BUCKETS> offsets{};
+
+        for (const auto& entry : m_order) {
+            offsets[(entry.key >> shift) & RADIX_MASK]++;
+        }
+
+        // All keys share this digit, so the pass wouldn't change the order
+        if (offsets[(m_order.front().key >> shift) & RADIX_MASK] == m_order.size()) {
+            continue;
+        }
+
+        size_t offset{0};
+        for (auto& bucket : offsets) {
+            offset += std::exchange(bucket, offset);
+        }
+
+        for (const auto& entry : m_order) {
+            m_scratch[offsets[(entry.key >> shift) & RADIX_MASK]++] = entry;
+        }
+
+        std::swap(m_order, m_scratch);
+    }
+}
+
+} // namespace GE::Scene
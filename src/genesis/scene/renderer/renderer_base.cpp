@@ -35,11 +35,13 @@
 #include "components.h"
 #include "entity.h"
 #include "entity_node.h"
+#include "scene.h"
 
 #include "genesis/core/log.h"
-#include "genesis/graphics/render_command.h"
 #include "genesis/graphics/renderer.h"
 
+#include <cmath>
+
 namespace GE::Scene {
 namespace {
 
@@ -47,106 +49,146 @@ constexpr Vec4 COLLIDER_COLOR{0.0f, 1.0f, 0.0f, 1.0f};
 
 } // namespace
 
-RendererBase::RendererBase(GE::Renderer* renderer, const ViewProjectionCamera* camera)
+RendererBase::RendererBase(GE::Renderer*               renderer,
+                           const Assets::Registry&     assets,
+                           const ViewProjectionCamera* camera)
     : m_renderer{renderer}
+    , m_assets{&assets}
     , m_primitives_renderer{m_renderer}
     , m_camera{camera}
 {}
 
-void RendererBase::renderEntity(GE::Renderer* renderer, Pipeline* pipeline, const Entity& entity)
+void RendererBase::updateVisibleEntities(const Scene& scene)
+{
+    auto        frustum = frustum_t::fromViewProjection(m_camera->viewProjection());
+    const auto& spatial_index = scene.spatialIndex();
+
+    m_visible_entities.clear();
+    m_visible_transforms.clear();
+    m_visible_texture_handles.clear();
+    m_visible_mesh_handles.clear();
+
+    spatial_index.queryFrustum(frustum, [this, &scene, &spatial_index](auto entity_handle) {
+        auto        entity = scene.entity(entity_handle);
+        const auto& sprite = entity.get<SpriteComponent>();
+
+        m_visible_entities.push_back(entity);
+        m_visible_transforms.push_back(spatial_index.worldTransform(entity_handle));
+        m_visible_texture_handles.push_back(sprite.texture);
+        m_visible_mesh_handles.push_back(sprite.mesh);
+    });
+
+    // Resources of all visible sprites are resolved in one pass over the asset tables
+    m_visible_textures.resize(m_visible_entities.size());
+    m_visible_meshes.resize(m_visible_entities.size());
+    m_assets->resolve(m_visible_texture_handles, m_visible_textures);
+    m_assets->resolve(m_visible_mesh_handles, m_visible_meshes);
+}
+
+void RendererBase::pushEntity(RenderQueue::Pass pass, Pipeline* pipeline, size_t visible_index)
 {
-    std::string_view entity_tag = entity.get<TagComponent>().tag;
+    const auto& entity = m_visible_entities[visible_index];
 
-    const auto& sprite = entity.get<SpriteComponent>();
-    auto*       texture = sprite.texture.get();
-    auto*       mesh = sprite.mesh.get();
+    RenderQueue::item_t item{};
+    item.pipeline = pipeline;
+    item.texture = m_visible_textures[visible_index];
+    item.mesh = m_visible_meshes[visible_index];
 
-    if (!isValid(entity_tag, pipeline, texture, mesh)) {
+    if (!isValid(entity, item.pipeline, item.texture, item.mesh)) {
         return;
     }
 
-    auto entity_transform = entity.get<TransformComponent>().transform();
-    auto parent_transform = parentTransform(entity);
-    auto mvp = m_camera->viewProjection() * parent_transform * entity_transform;
+    item.mvp = m_camera->viewProjection() * m_visible_transforms[visible_index];
 
-    auto* cmd = renderer->command();
-    cmd->bind(pipeline);
-    cmd->bind(pipeline, "u_Sprite", *texture);
-    cmd->pushConstant(pipeline, "pc.mvp", mvp);
-    cmd->draw(*mesh);
+    m_render_queue.push(pass, item);
 }
 
-void RendererBase::renderPhysics2DColliders(const Entity& entity)
+void RendererBase::renderPhysics2DColliders(const Scene& scene)
 {
-    if (entity.has<CircleCollider2DComponent>()) {
-        renderCircleCollider2D(entity);
-    }
+    const auto& spatial_index = scene.spatialIndex();
 
-    if (entity.has<BoxCollider2DComponent>()) {
-        renderBoxCollider2D(entity);
-    }
+    // The world transforms are cached by the spatial index, so the parents aren't walked per body
+    scene.forEach<RigidBody2DComponent>([this, &spatial_index](const Entity& entity) {
+        bool has_circle = entity.has<CircleCollider2DComponent>();
+        bool has_box = entity.has<BoxCollider2DComponent>();
+
+        if (!has_circle && !has_box) {
+            return;
+        }
+
+        auto entity_transform = spatial_index.worldTransform(entity.nativeHandle());
+
+        if (has_circle) {
+            addCircleCollider2D(entity, entity_transform);
+        }
+
+        if (has_box) {
+            addBoxCollider2D(entity, entity_transform);
+        }
+    });
+
+    m_primitives_renderer.renderLines(m_camera->viewProjection());
 }
 
-void RendererBase::renderCircleCollider2D(const Entity& entity)
+void RendererBase::addCircleCollider2D(const Entity& entity, const Mat4& entity_transform)
 {
     const auto& collider = entity.get<CircleCollider2DComponent>();
     if (!collider.show_collider) {
         return;
     }
 
-    auto entity_transform = parentTransform(entity) * entity.get<TransformComponent>().transform();
-    auto [entity_translation, entity_rotation, entity_scale] = decompose(entity_transform);
-    float scale_max = std::max(entity_scale.x, entity_scale.y);
-
-    constexpr float COLLIDER_ANGLE{0.0f};
-    Vec2            collider_size{collider.radius * 2.0f, collider.radius * 2.0f};
+    // A circle stays round under non-uniform scale, so only the largest axis is taken
+    Vec2  axis_x{entity_transform[0]};
+    Vec2  axis_y{entity_transform[1]};
+    float scale_max = std::max(length(axis_x), length(axis_y));
+    float angle = std::atan2(axis_x.y, axis_x.x);
 
-    auto transform =
-        m_camera->viewProjection() *
-        makeTransform2D(entity_translation, entity_rotation.z, Vec2{scale_max, scale_max}) *
-        makeTransform2D(collider.offset, COLLIDER_ANGLE, collider_size);
+    auto circle_transform =
+        makeTransform2D(Vec2{entity_transform[3]}, angle, Vec2{scale_max, scale_max});
+    Vec2 center{circle_transform * Vec4{collider.offset, 0.0f, 1.0f}};
 
-    m_primitives_renderer.renderCircle(transform, COLLIDER_COLOR);
+    m_primitives_renderer.addCircle(center, collider.radius * scale_max, COLLIDER_COLOR);
 }
 
-void RendererBase::renderBoxCollider2D(const Entity& entity)
+void RendererBase::addBoxCollider2D(const Entity& entity, const Mat4& entity_transform)
 {
     const auto& collider = entity.get<BoxCollider2DComponent>();
     if (!collider.show_collider) {
         return;
     }
 
-    auto entity_transform = parentTransform(entity) * entity.get<TransformComponent>().transform();
-    auto [entity_translation, entity_rotation, entity_scale] = decompose(entity_transform);
-
-    auto transform = m_camera->viewProjection() *
-                     makeTransform2D(entity_translation, entity_rotation.z, entity_scale) *
-                     makeTransform2D(collider.center, collider.angle, collider.size);
+    auto transform =
+        entity_transform * makeTransform2D(collider.center, collider.angle, collider.size);
 
-    m_primitives_renderer.renderSquare(transform, COLLIDER_COLOR);
+    m_primitives_renderer.addSquare(transform, COLLIDER_COLOR);
 }
 
-bool RendererBase::isValid(std::string_view entity_name,
-                           Pipeline*        material,
-                           Texture*         texture,
-                           Mesh*            mesh) const
+bool RendererBase::isValid(const Entity& entity, Pipeline* material, Texture* texture, Mesh* mesh)
 {
-    if (material == nullptr) {
-        GE_CORE_ERR("A pipeline for an entity '{}' is null", entity_name);
-        return false;
+    if (material != nullptr && texture != nullptr && mesh != nullptr) {
+        if (!m_invalid_entities.empty()) {
+            m_invalid_entities.erase(entity.nativeHandle());
+        }
+
+        return true;
     }
 
-    if (texture == nullptr) {
-        GE_CORE_ERR("A texture for an entity '{}' is null", entity_name);
+    // Report a broken entity once instead of every frame it stays visible
+    if (!m_invalid_entities.insert(entity.nativeHandle()).second) {
         return false;
     }
 
-    if (mesh == nullptr) {
+    std::string_view entity_name = entity.get<TagComponent>().tag();
+
+    if (material == nullptr) {
+        GE_CORE_ERR("A pipeline for an entity '{}' is null", entity_name);
+    } else if (texture == nullptr) {
+        GE_CORE_ERR("A texture for an entity '{}' is null", entity_name);
+    } else {
         GE_CORE_ERR("A mesh for an entity '{}' is null", entity_name);
-        return false;
     }
 
-    return true;
+    return false;
 }
 
 Mat4 parentTransform(const Entity& entity)
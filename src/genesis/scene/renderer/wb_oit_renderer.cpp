@@ -51,47 +51,7 @@ const Assets::ResourceID ACCUMULATION_PIPELINE{"genesis", Assets::Group::PIPELIN
 const Assets::ResourceID COMPOSING_PIPELINE{"genesis", Assets::Group::PIPELINES,
                                             "wb_oit_composing"};
 
-bool isOpaque(const Entity& entity)
-{
-    return entity.get<SpriteComponent>().texture->isOpaque();
-}
-
-} // namespace
-
-WeightedBlendedOITRenderer::WeightedBlendedOITRenderer(GE::Renderer*               renderer,
-                                                       const Assets::Registry&     assets,
-                                                       const ViewProjectionCamera* camera)
-    : RendererBase{renderer, camera}
-{
-    recreateWbOitFramebuffer(m_renderer->size());
-
-    auto* wb_oit_renderer = m_wb_oit_fbo->renderer();
-    createOpaqueColorPipeline(wb_oit_renderer, assets);
-    createAccumulationPipeline(wb_oit_renderer, assets);
-    createComposingPipeline(m_renderer, assets);
-}
-
-void WeightedBlendedOITRenderer::render(const Scene& scene)
-{
-    if (m_renderer->size() != m_wb_oit_fbo->size()) {
-        recreateWbOitFramebuffer(m_renderer->size());
-    }
-
-    auto* wb_oit_renderer = m_wb_oit_fbo->renderer();
-
-    wb_oit_renderer->beginFrame(Renderer::CLEAR_ALL);
-    renderOpaqueEntities(wb_oit_renderer, scene);
-    renderTransparentEntities(wb_oit_renderer, scene);
-    wb_oit_renderer->endFrame();
-    wb_oit_renderer->swapBuffers();
-
-    m_renderer->beginFrame(Renderer::CLEAR_ALL);
-    composeScene(m_renderer);
-    renderPhysicsColliders(scene);
-    m_renderer->endFrame();
-}
-
-void WeightedBlendedOITRenderer::recreateWbOitFramebuffer(const Vec2& size)
+Framebuffer::config_t wbOitFramebufferConfig(const Vec2& size)
 {
     Framebuffer::config_t config{};
     config.size = size;
@@ -119,7 +79,67 @@ void WeightedBlendedOITRenderer::recreateWbOitFramebuffer(const Vec2& size)
          .clear_depth = 1.0f},
     };
 
-    m_wb_oit_fbo = Framebuffer::create(config);
+    return config;
+}
+
+bool isOpaque(const Texture* texture)
+{
+    return texture == nullptr || texture->isOpaque();
+}
+
+} // namespace
+
+WeightedBlendedOITRenderer::WeightedBlendedOITRenderer(GE::Renderer*               renderer,
+                                                       const Assets::Registry&     assets,
+                                                       const ViewProjectionCamera* camera)
+    : RendererBase{renderer, assets, camera}
+{
+    buildRenderGraph();
+
+    auto* wb_oit_renderer = m_render_graph.renderer(m_wb_oit_target);
+    createOpaqueColorPipeline(wb_oit_renderer, assets);
+    createAccumulationPipeline(wb_oit_renderer, assets);
+    createComposingPipeline(m_renderer, assets);
+}
+
+void WeightedBlendedOITRenderer::render(const Scene& scene)
+{
+    updateVisibleEntities(scene);
+    buildRenderQueue();
+
+    m_scene = &scene;
+    m_render_graph.setTargetSize(m_wb_oit_target, m_renderer->size());
+    m_render_graph.execute();
+    m_scene = nullptr;
+}
+
+void WeightedBlendedOITRenderer::buildRenderGraph()
+{
+    m_wb_oit_target =
+        m_render_graph.createTarget("wb_oit", wbOitFramebufferConfig(m_renderer->size()));
+    auto backbuffer = m_render_graph.importTarget("backbuffer", m_renderer);
+
+    m_render_graph.addPass("opaque", m_wb_oit_target, {}, Renderer::CLEAR_ALL,
+                           [this](GE::Renderer* renderer, RenderGraph*) {
+                               m_render_queue.submit(renderer,
+                                                     RenderQueue::Pass::OPAQUE_ENTITIES);
+                           });
+
+    m_render_graph.addPass("transparent", m_wb_oit_target, {}, Renderer::CLEAR_NONE,
+                           [this](GE::Renderer* renderer, RenderGraph*) {
+                               m_render_queue.submit(renderer,
+                                                     RenderQueue::Pass::TRANSPARENT_ENTITIES);
+                           });
+
+    m_render_graph.addPass("compose", backbuffer, {m_wb_oit_target}, Renderer::CLEAR_ALL,
+                           [this](GE::Renderer* renderer, RenderGraph* graph) {
+                               composeScene(renderer, *graph->framebuffer(m_wb_oit_target));
+                           });
+
+    m_render_graph.addPass("colliders", backbuffer, {}, Renderer::CLEAR_NONE,
+                           [this](GE::Renderer*, RenderGraph*) {
+                               renderPhysicsColliders(*m_scene);
+                           });
 }
 
 void WeightedBlendedOITRenderer::createOpaqueColorPipeline(GE::Renderer*           renderer,
@@ -197,34 +217,27 @@ void WeightedBlendedOITRenderer::createComposingPipeline(GE::Renderer*
     GE_CORE_ASSERT(m_composing_pipeline, "Failed to create composing pipeline");
 }
 
-void WeightedBlendedOITRenderer::renderOpaqueEntities(GE::Renderer* renderer, const Scene& scene)
+void WeightedBlendedOITRenderer::buildRenderQueue()
 {
-    scene.forEach<SpriteComponent>([this, renderer](const auto& entity) {
-        if (isOpaque(entity)) {
-            renderEntity(renderer, m_color_pipeline.get(), entity);
-        }
-    });
-}
+    m_render_queue.clear();
 
-void WeightedBlendedOITRenderer::renderTransparentEntities(GE::Renderer* renderer,
-                                                           const Scene&  scene)
-{
-    scene.forEach<SpriteComponent>([this, renderer](const auto& entity) {
-        if (!isOpaque(entity)) {
-            renderEntity(renderer, m_accumulation_pipeline.get(), entity);
+    for (size_t i{0}; i < m_visible_entities.size(); ++i) {
+        if (isOpaque(m_visible_textures[i])) {
+            pushEntity(RenderQueue::Pass::OPAQUE_ENTITIES, m_color_pipeline.get(), i);
+        } else {
+            pushEntity(RenderQueue::Pass::TRANSPARENT_ENTITIES, m_accumulation_pipeline.get(), i);
         }
-    });
+    }
+
+    m_render_queue.sort();
 }
 
 void WeightedBlendedOITRenderer::renderPhysicsColliders(const Scene& scene)
 {
-    m_primitives_renderer.begin();
-    scene.forEach<RigidBody2DComponent>(
-        [this](const auto& entity) { renderPhysics2DColliders(entity); });
-    m_primitives_renderer.end();
+    renderPhysics2DColliders(scene);
 }
 
-void WeightedBlendedOITRenderer::composeScene(GE::Renderer* renderer)
+void WeightedBlendedOITRenderer::composeScene(GE::Renderer* renderer, const Framebuffer& wb_oit_fbo)
 {
     auto* cmd = renderer->command();
     auto* pipeline = m_composing_pipeline.get();
@@ -232,9 +245,9 @@ void WeightedBlendedOITRenderer::composeScene(GE::Renderer* renderer)
     constexpr uint32_t VERTEX_COUNT{6};
 
     cmd->bind(pipeline);
-    cmd->bind(pipeline, "u_ColorTex", m_wb_oit_fbo->colorTexture(0));
-    cmd->bind(pipeline, "u_AccumTex", m_wb_oit_fbo->colorTexture(1));
-    cmd->bind(pipeline, "u_RevealTex", m_wb_oit_fbo->colorTexture(2));
+    cmd->bind(pipeline, "u_ColorTex", wb_oit_fbo.colorTexture(0));
+    cmd->bind(pipeline, "u_AccumTex", wb_oit_fbo.colorTexture(1));
+    cmd->bind(pipeline, "u_RevealTex", wb_oit_fbo.colorTexture(2));
     cmd->draw(VERTEX_COUNT, 1, 0, 0);
 }
 
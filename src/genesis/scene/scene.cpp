@@ -32,9 +32,12 @@
 
 #include "scene.h"
 #include "components/relationship_components.h"
+#include "components/sprite_component.h"
 #include "components/tag_component.h"
 #include "components/transform_component.h"
 #include "entity.h"
+#include "entity_node.h"
+#include "prefab.h"
 
 namespace GE::Scene {
 namespace {
@@ -43,18 +46,30 @@ constexpr auto DEFAULT_ENTITY_NAME{"Entity"};
 
 } // namespace
 
+Scene::Scene()
+{
+    observeIndices(&m_registry);
+}
+
 Scene::Scene(Scene&& other) noexcept
     : m_name{std::move(other.m_name)}
+    , m_name_index{std::move(other.m_name_index)}
+    , m_spatial_index{std::move(other.m_spatial_index)}
     , m_registry{std::move(other.m_registry)}
     , m_main_camera{other.m_main_camera}
-{}
+{
+    reobserveIndices(&other);
+}
 
 Scene& Scene::operator=(Scene&& other) noexcept
 {
     if (this != &other) {
         m_name = std::move(other.m_name);
+        m_name_index = std::move(other.m_name_index);
+        m_spatial_index = std::move(other.m_spatial_index);
         m_registry = std::move(other.m_registry);
         m_main_camera = other.m_main_camera;
+        reobserveIndices(&other);
     }
 
     return *this;
@@ -63,7 +78,7 @@ Scene& Scene::operator=(Scene&& other) noexcept
 Entity Scene::createEntity(std::string_view name)
 {
     auto entity = m_registry.create();
-    entity.add<TagComponent>(!name.empty() ? name.data() : DEFAULT_ENTITY_NAME);
+    entity.add<TagComponent>(!name.empty() ? name : DEFAULT_ENTITY_NAME);
     entity.add<TransformComponent>();
     entity.add<NodeComponent>();
 
@@ -75,26 +90,69 @@ Entity Scene::createEntity(std::string_view name)
     return entity;
 }
 
-Entity Scene::entity(Entity::NativeHandle entity_handle)
+std::vector<Entity::NativeHandle> Scene::createEntities(size_t count)
+{
+    return m_registry.createMany(count);
+}
+
+Entity Scene::entity(Entity::NativeHandle entity_handle) const
 {
     return m_registry.entity(entity_handle);
 }
 
+bool Scene::isValid(Entity::NativeHandle entity_handle) const
+{
+    return m_registry.isValid(entity_handle);
+}
+
+Entity Scene::findEntity(std::string_view name) const
+{
+    return m_registry.entity(m_name_index.find(name));
+}
+
 void Scene::destroyEntity(const Entity& entity)
 {
-    m_registry.destroy(entity);
+    destroyEntity(entity.nativeHandle());
 }
 
 void Scene::destroyEntity(Entity::NativeHandle entity_handle)
 {
+    m_spatial_index.remove(entity_handle);
     m_registry.destroy(entity_handle);
 }
 
+void Scene::destroyEntities(std::span<const Entity::NativeHandle> entities)
+{
+    for (auto entity : entities) {
+        m_spatial_index.remove(entity);
+    }
+
+    m_registry.destroyMany(entities);
+}
+
 void Scene::clear()
 {
+    m_spatial_index.clear();
+    m_name_index.clear();
     m_registry.clear();
 }
 
+Entity Scene::cloneEntity(const Entity& entity, Scene* destination, const Entity& parent) const
+{
+    auto roots = Prefab{entity}.instantiate(destination, 1, parent);
+    return !roots.empty() ? roots.front() : Entity{};
+}
+
+Entity Scene::duplicateEntity(const Entity& entity)
+{
+    return cloneEntity(entity, this, EntityNode{entity}.parentNode().entity());
+}
+
+void Scene::updateSpatialIndex(const Assets::Registry& assets)
+{
+    m_spatial_index.update(*this, assets);
+}
+
 Entity Scene::headEntity() const
 {
     return m_registry.firstEntityWith<HeadNodeComponent>();
@@ -105,6 +163,25 @@ Entity Scene::tailEnity() const
     return m_registry.firstEntityWith<TailNodeComponent>();
 }
 
+void Scene::observeIndices(Registry* registry)
+{
+    registry->observe<TagComponent>(&m_name_index);
+    registry->observe<TransformComponent>(&m_spatial_index);
+    registry->observe<SpriteComponent>(&m_spatial_index);
+    registry->observe<NodeComponent>(&m_spatial_index);
+}
+
+void Scene::reobserveIndices(Scene* moved_from)
+{
+    // The moved registry still notifies the indices of the moved-from scene
+    m_registry.unobserve<TagComponent>(&moved_from->m_name_index);
+    m_registry.unobserve<TransformComponent>(&moved_from->m_spatial_index);
+    m_registry.unobserve<SpriteComponent>(&moved_from->m_spatial_index);
+    m_registry.unobserve<NodeComponent>(&moved_from->m_spatial_index);
+    observeIndices(&m_registry);
+    moved_from->observeIndices(&moved_from->m_registry);
+}
+
 void Scene::forEachEntity(const Scene::ForeachCallback& callback)
 {
     m_registry.eachEntity(callback);
@@ -31,40 +31,25 @@
  */
 
 #include "scene_deserializer.h"
+#include "component_list.h"
 #include "components.h"
 #include "entity.h"
 #include "entity_node.h"
 #include "scene.h"
 
+#include "genesis/core/hash.h"
 #include "genesis/core/log.h"
-#include "genesis/core/utils.h"
 
 #include <yaml-cpp/yaml.h>
 
-#include <unordered_map>
-
-#define BIND_LOADER(mem_function)                                                                  \
-    [this](auto* entity, const auto& node) { mem_function(entity, node); }
-
-#define ADD_LOADER(component_type) {component_type::NAME.data(), &load<component_type>}
-
-#define ADD_MEM_FN_LOADER(component_type)                                                          \
-    {component_type::NAME.data(), BIND_LOADER(load##component_type)}
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <limits>
+#include <utility>
+#include <type_traits>
 
 namespace GE::Scene {
-namespace {
-
-template<typename ComponentType>
-void load(Entity* entity, const YAML::Node& node)
-{
-    if (!entity->has<ComponentType>()) {
-        entity->add<ComponentType>();
-    }
-
-    entity->get<ComponentType>() = node.as<ComponentType>();
-}
-
-} // namespace
 
 SceneDeserializer::SceneDeserializer(Scene* scene, Assets::Registry* assets)
     : m_scene{scene}
@@ -73,52 +58,112 @@ SceneDeserializer::SceneDeserializer(Scene* scene, Assets::Registry* assets)
 
 bool SceneDeserializer::deserialize(const std::string& config_filepath)
 {
-    m_scene_buffer.clear();
+    m_filepath = config_filepath;
 
     try {
-        YAML::Node node = YAML::LoadFile(config_filepath);
+        return deserialize(YAML::LoadFile(config_filepath));
+    } catch (const std::exception& e) {
+        fail(e.what());
+        return false;
+    }
+}
 
-        if (auto version = node["scene"]["serialization_version"].as<uint32_t>();
-            version < Scene::SERIALIZATION_VERSION) {
-            GE_CORE_ERR("Inconsistent serialization version: {}, expected: {}", version,
-                        Scene::SERIALIZATION_VERSION);
+bool SceneDeserializer::deserialize(const YAML::Node& node)
+{
+    try {
+        if (!beginLoading(node)) {
             return false;
         }
+    } catch (const std::exception& e) {
+        fail(e.what());
+        return false;
+    }
 
-        m_scene_buffer.setName(node["scene"]["name"].as<std::string>());
+    return update(std::numeric_limits<double>::max()) == Status::DONE;
+}
 
-        if (auto entities = node["scene"]["entities"]; entities.size() > 0) {
-            loadEntities(&m_scene_buffer, entities);
+void SceneDeserializer::start(const std::string& config_filepath)
+{
+    m_filepath = config_filepath;
+    m_status = Status::PARSING;
+    m_parsed_node = std::async(std::launch::async,
+                               [config_filepath] { return YAML::LoadFile(config_filepath); });
+}
+
+SceneDeserializer::Status SceneDeserializer::update(Timestamp budget)
+{
+    auto start_time = Timestamp::now();
+
+    try {
+        if (m_status == Status::PARSING) {
+            if (m_parsed_node.wait_for(std::chrono::seconds{0}) != std::future_status::ready) {
+                return m_status;
+            }
+
+            if (!beginLoading(m_parsed_node.get())) {
+                return m_status;
+            }
+        }
+
+        while (m_status == Status::LOADING && !m_entity_lists.empty()) {
+            loadNextEntity();
+
+            if (Timestamp::now() - start_time >= budget) {
+                return m_status;
+            }
         }
     } catch (const std::exception& e) {
-        GE_CORE_ERR("Failed to deserialize a scene from a file '{}': '{}'", config_filepath,
-                    e.what());
-        return false;
+        fail(e.what());
+        return m_status;
     }
 
-    *m_scene = std::move(m_scene_buffer);
-    return true;
+    if (m_status == Status::LOADING) {
+        finishLoading();
+    }
+
+    return m_status;
 }
 
-// NOLINTNEXTLINE(misc-no-recursion)
-Entity SceneDeserializer::loadEntities(Scene* scene, const YAML::Node& node)
+bool SceneDeserializer::beginLoading(const YAML::Node& node)
 {
-    auto first_entity = loadEntity(scene, node[0]);
-    auto last_entity = first_entity;
+    m_scene_buffer.clear();
+    m_entity_lists.clear();
+    m_loaded_entity_count = 0;
+
+    if (auto version = node["scene"]["serialization_version"].as<uint32_t>();
+        version < Scene::SERIALIZATION_VERSION) {
+        GE_CORE_ERR("Inconsistent serialization version: {}, expected: {}", version,
+                    Scene::SERIALIZATION_VERSION);
+        m_status = Status::FAILED;
+        return false;
+    }
 
-    for (uint32_t i{1}; i < node.size(); i++) {
-        auto entity = loadEntity(scene, node[i]);
-        EntityNode{last_entity}.insert(entity);
-        last_entity = entity;
+    m_scene_buffer.setName(node["scene"]["name"].as<std::string>());
+
+    if (auto entities = node["scene"]["entities"]; entities.size() > 0) {
+        m_entity_lists.push_back({entities});
     }
 
-    return first_entity;
+    m_status = Status::LOADING;
+    return true;
 }
 
-// NOLINTNEXTLINE(misc-no-recursion)
-Entity SceneDeserializer::loadEntity(Scene* scene, const YAML::Node& node)
+// Entities are loaded depth first with an explicit stack, so the loading can stop after any
+// entity and resume on the next update
+void SceneDeserializer::loadNextEntity()
 {
-    auto entity = scene->createEntity();
+    auto& list = m_entity_lists.back();
+    auto  node = std::as_const(list.nodes)[list.index++];
+    auto  entity = m_scene_buffer.createEntity();
+
+    if (!list.last_entity.isNull()) {
+        EntityNode{list.last_entity}.insert(entity);
+    } else if (!list.parent.isNull()) {
+        EntityNode{list.parent}.appendChild(entity);
+    }
+
+    list.last_entity = entity;
+    m_loaded_entity_count++;
 
     for (auto component_node : node["components"]) {
         if (!loadComponent(&entity, component_node)) {
@@ -126,38 +171,109 @@ Entity SceneDeserializer::loadEntity(Scene* scene, const YAML::Node& node)
         }
     }
 
+    if (list.index == list.nodes.size()) {
+        m_entity_lists.pop_back();
+    }
+
     if (auto children_node = node["children"]; children_node.IsDefined()) {
-        EntityNode{entity}.appendChild(loadEntities(scene, children_node));
+        m_entity_lists.push_back({children_node, 0, entity});
+    }
+}
+
+void SceneDeserializer::finishLoading()
+{
+    *m_scene = std::move(m_scene_buffer);
+    m_status = Status::DONE;
+}
+
+void SceneDeserializer::fail(std::string_view error)
+{
+    GE_CORE_ERR("Failed to deserialize a scene from a file '{}': '{}'", m_filepath, error);
+    m_entity_lists.clear();
+    m_scene_buffer.clear();
+    m_status = Status::FAILED;
+}
+
+template<typename T>
+void SceneDeserializer::loadComponent(Entity* entity, const YAML::Node& node)
+{
+    if (entity->has<T>()) {
+        // Patch rather than assign so the observers, e.g. the name index, see the loaded value
+        entity->patch<T>([component = node.as<T>()](T& existing) mutable {
+            existing = std::move(component);
+        });
+    } else {
+        entity->add<T>(node.as<T>());
     }
+}
 
-    return entity;
+template<>
+void SceneDeserializer::loadComponent<MaterialComponent>(Entity* entity, const YAML::Node& node)
+{
+    if (auto material = node.as<MaterialComponent>();
+        m_assets == nullptr || material.loadMaterial(m_assets)) {
+        entity->add<MaterialComponent>(std::move(material));
+    }
+}
+
+template<>
+void SceneDeserializer::loadComponent<SpriteComponent>(Entity* entity, const YAML::Node& node)
+{
+    // Earlier scenes keep the resource IDs inside the sprite node
+    if (auto resources_node = node["resources"]; resources_node.IsDefined()) {
+        entity->add<SpriteResourcesComponent>(resources_node["texture"].as<Assets::ResourceID>(),
+                                              resources_node["mesh"].as<Assets::ResourceID>());
+    }
+
+    // Resources are serialized ahead of the sprite, so the handles can be resolved right away
+    auto        sprite = node.as<SpriteComponent>();
+    const auto* resources = entity->has<SpriteResourcesComponent>()
+                                ? &entity->get<SpriteResourcesComponent>()
+                                : nullptr;
+
+    if (m_assets == nullptr || (resources != nullptr && resources->loadAll(&sprite, m_assets))) {
+        entity->add<SpriteComponent>(std::move(sprite));
+    }
 }
 
 bool SceneDeserializer::loadComponent(Entity* entity, const YAML::Node& node)
 {
-    using Loader = std::function<void(Entity*, const YAML::Node&)>;
-
-    const std::unordered_map<std::string, Loader> LOADERS = {
-        ADD_LOADER(CameraComponent),
-        ADD_MEM_FN_LOADER(MaterialComponent),
-        ADD_LOADER(RigidBody2DComponent),
-        ADD_LOADER(BoxCollider2DComponent),
-        ADD_LOADER(CircleCollider2DComponent),
-        ADD_MEM_FN_LOADER(SpriteComponent),
-        ADD_LOADER(TagComponent),
-        ADD_LOADER(TransformComponent),
+    using Loader = void (SceneDeserializer::*)(Entity*, const YAML::Node&);
+
+    struct loader_t {
+        uint64_t type_hash{0};
+        Loader   load{nullptr};
     };
 
-    if (!node["type"].IsDefined()) {
+    // The table is built once, a component is then dispatched by the hash of its type name
+    static const auto LOADERS = [] {
+        std::array<loader_t, typeListSize<ComponentList>()> loaders{};
+        size_t                                               index{0};
+
+        forEachType<ComponentList>([&loaders, &index](const auto& component) {
+            using Component = std::decay_t<decltype(component)>;
+            loaders[index++] = {stringHash(Component::NAME),
+                                &SceneDeserializer::loadComponent<Component>};
+        });
+
+        return loaders;
+    }();
+
+    auto type_node = node["type"];
+
+    if (!type_node.IsDefined()) {
         GE_CORE_ERR("Failed to load component: 'type' is not defined");
         return false;
     }
 
-    auto type = node["type"].as<std::string>();
+    const auto& type = type_node.Scalar();
+    auto        loader = std::find_if(
+        LOADERS.begin(), LOADERS.end(),
+        [type_hash = stringHash(type)](const auto& item) { return item.type_hash == type_hash; });
 
-    if (auto loader = getValue(LOADERS, type); loader) {
+    if (loader != LOADERS.end()) {
         try {
-            std::invoke(loader, entity, node);
+            (this->*loader->load)(entity, node);
         } catch (const std::exception& e) {
             GE_CORE_WARN("Failed to load component '{}': '{}'", type, e.what());
         }
@@ -166,18 +282,4 @@ bool SceneDeserializer::loadComponent(Entity* entity, const YAML::Node& node)
     return true;
 }
 
-void SceneDeserializer::loadMaterialComponent(Entity* entity, const YAML::Node& node)
-{
-    if (auto material = node.as<MaterialComponent>(); material.loadMaterial(m_assets)) {
-        entity->add<MaterialComponent>() = material;
-    }
-}
-
-void SceneDeserializer::loadSpriteComponent(Entity* entity, const YAML::Node& node)
-{
-    if (auto sprite = node.as<SpriteComponent>(); sprite.loadAll(m_assets)) {
-        entity->add<SpriteComponent>() = sprite;
-    }
-}
-
 } // namespace GE::Scene
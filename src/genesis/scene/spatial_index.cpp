@@ -0,0 +1,473 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2024, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "spatial_index.h"
+#include "components/sprite_component.h"
+#include "components/transform_component.h"
+#include "entity_node.h"
+#include "scene.h"
+
+#include "genesis/assets/registry.h"
+#include "genesis/graphics/mesh.h"
+
+namespace GE::Scene {
+namespace {
+
+constexpr float REINSERT_SHRINK_FACTOR{4.0f};
+
+} // namespace
+
+// A dirty entity under a dirty ancestor is refreshed with the subtree of the ancestor
+void SpatialIndex::update(const Scene& scene, const Assets::Registry& assets)
+{
+    if (m_dirty.empty()) {
+        return;
+    }
+
+    std::vector<NativeHandle> roots;
+
+    for (auto entity : m_dirty) {
+        if (!scene.isValid(entity)) {
+            remove(entity);
+        } else if (!hasDirtyAncestor(EntityNode{scene.entity(entity)})) {
+            roots.push_back(entity);
+        }
+    }
+
+    m_dirty.clear();
+
+    for (auto entity : roots) {
+        EntityNode root{scene.entity(entity)};
+        updateSubtree(root, parentWorldTransform(root), assets);
+    }
+}
+
+void SpatialIndex::clear()
+{
+    m_nodes.clear();
+    m_free_nodes.clear();
+    m_proxies.clear();
+    m_unbounded.clear();
+    m_dirty.clear();
+    m_root = NULL_NODE;
+    m_leaf_count = 0;
+}
+
+void SpatialIndex::insert(NativeHandle entity, const aabb_t& bounds)
+{
+    auto& proxy = m_proxies[entity];
+
+    if (proxy.node != NULL_NODE) {
+        move(entity, bounds);
+        return;
+    }
+
+    m_unbounded.erase(entity);
+
+    auto leaf = allocateNode();
+    m_nodes[leaf].bounds = bounds.fattened(AABB_MARGIN);
+    m_nodes[leaf].tight_bounds = bounds;
+    m_nodes[leaf].entity = entity;
+    insertLeaf(leaf);
+
+    proxy.node = leaf;
+    m_leaf_count++;
+}
+
+void SpatialIndex::insertUnbounded(NativeHandle entity)
+{
+    detachLeaf(&m_proxies[entity]);
+    m_unbounded.insert(entity);
+}
+
+void SpatialIndex::move(NativeHandle entity, const aabb_t& bounds)
+{
+    auto proxy = m_proxies.find(entity);
+    if (proxy == m_proxies.end() || proxy->second.node == NULL_NODE) {
+        insert(entity, bounds);
+        return;
+    }
+
+    auto  leaf = proxy->second.node;
+    auto& node = m_nodes[leaf];
+    node.tight_bounds = bounds;
+
+    if (node.bounds.contains(bounds) &&
+        bounds.fattened(REINSERT_SHRINK_FACTOR * AABB_MARGIN).contains(node.bounds)) {
+        return;
+    }
+
+    removeLeaf(leaf);
+    m_nodes[leaf].bounds = bounds.fattened(AABB_MARGIN);
+    insertLeaf(leaf);
+}
+
+void SpatialIndex::remove(NativeHandle entity)
+{
+    m_unbounded.erase(entity);
+
+    auto proxy = m_proxies.find(entity);
+    if (proxy == m_proxies.end()) {
+        return;
+    }
+
+    detachLeaf(&proxy->second);
+    m_proxies.erase(proxy);
+}
+
+bool SpatialIndex::contains(NativeHandle entity) const
+{
+    auto proxy = m_proxies.find(entity);
+    return (proxy != m_proxies.end() && proxy->second.node != NULL_NODE) ||
+           m_unbounded.contains(entity);
+}
+
+aabb_t SpatialIndex::bounds(NativeHandle entity) const
+{
+    if (auto proxy = m_proxies.find(entity);
+        proxy != m_proxies.end() && proxy->second.node != NULL_NODE) {
+        return m_nodes[proxy->second.node].tight_bounds;
+    }
+
+    return {};
+}
+
+Mat4 SpatialIndex::worldTransform(NativeHandle entity) const
+{
+    auto proxy = m_proxies.find(entity);
+    return proxy != m_proxies.end() ? proxy->second.world_transform : Mat4{1.0f};
+}
+
+int32_t SpatialIndex::height() const
+{
+    return m_root != NULL_NODE ? m_nodes[m_root].height : 0;
+}
+
+// NOLINTNEXTLINE(misc-no-recursion)
+void SpatialIndex::updateSubtree(const EntityNode&       root,
+                                 const Mat4&             parent_transform,
+                                 const Assets::Registry& assets)
+{
+    const auto& entity = root.entity();
+    auto world_transform = parent_transform * entity.get<TransformComponent>().transform();
+    updateEntity(entity, world_transform, assets);
+
+    for (auto child = root.childNode(); !child.isNull(); child = child.nextNode()) {
+        updateSubtree(child, world_transform, assets);
+    }
+}
+
+void SpatialIndex::updateEntity(const Entity&           entity,
+                                const Mat4&             world_transform,
+                                const Assets::Registry& assets)
+{
+    auto  handle = entity.nativeHandle();
+    auto& proxy = m_proxies[handle];
+    proxy.world_transform = world_transform;
+
+    const Mesh* mesh{nullptr};
+    if (entity.has<SpriteComponent>()) {
+        mesh = assets.resolve(entity.get<SpriteComponent>().mesh);
+    }
+
+    // Only the entities with a sprite mesh are reported by the queries
+    if (mesh == nullptr) {
+        detachLeaf(&proxy);
+        m_unbounded.erase(handle);
+        return;
+    }
+
+    if (auto bounds = transformAabb(mesh->bounds(), world_transform); bounds.isValid()) {
+        move(handle, bounds);
+    } else {
+        insertUnbounded(handle);
+    }
+}
+
+bool SpatialIndex::hasDirtyAncestor(const EntityNode& node) const
+{
+    for (auto parent = node.parentNode(); !parent.isNull(); parent = parent.parentNode()) {
+        if (m_dirty.contains(parent.entity().nativeHandle())) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// The world transform of a clean parent is up to date, only the unknown ones are recomputed
+// NOLINTNEXTLINE(misc-no-recursion)
+Mat4 SpatialIndex::parentWorldTransform(const EntityNode& node) const
+{
+    auto parent = node.parentNode();
+    if (parent.isNull()) {
+        return Mat4{1.0f};
+    }
+
+    if (auto proxy = m_proxies.find(parent.entity().nativeHandle()); proxy != m_proxies.end()) {
+        return proxy->second.world_transform;
+    }
+
+    return parentWorldTransform(parent) * parent.entity().get<TransformComponent>().transform();
+}
+
+void SpatialIndex::detachLeaf(proxy_t* proxy)
+{
+    if (proxy->node == NULL_NODE) {
+        return;
+    }
+
+    removeLeaf(proxy->node);
+    freeNode(proxy->node);
+    proxy->node = NULL_NODE;
+    m_leaf_count--;
+}
+
+int32_t SpatialIndex::allocateNode()
+{
+    if (!m_free_nodes.empty()) {
+        auto node = m_free_nodes.back();
+        m_free_nodes.pop_back();
+        m_nodes[node] = {};
+        return node;
+    }
+
+    m_nodes.emplace_back();
+    return static_cast<int32_t>(m_nodes.size() - 1);
+}
+
+void SpatialIndex::freeNode(int32_t node)
+{
+    m_nodes[node] = {};
+    m_free_nodes.push_back(node);
+}
+
+void SpatialIndex::insertLeaf(int32_t leaf)
+{
+    if (m_root == NULL_NODE) {
+        m_root = leaf;
+        m_nodes[leaf].parent = NULL_NODE;
+        return;
+    }
+
+    auto sibling = findSibling(m_nodes[leaf].bounds);
+    auto old_parent = m_nodes[sibling].parent;
+    auto new_parent = allocateNode();
+
+    m_nodes[new_parent].parent = old_parent;
+    m_nodes[new_parent].bounds = m_nodes[leaf].bounds.merged(m_nodes[sibling].bounds);
+    m_nodes[new_parent].height = m_nodes[sibling].height + 1;
+    m_nodes[new_parent].left = sibling;
+    m_nodes[new_parent].right = leaf;
+    m_nodes[sibling].parent = new_parent;
+    m_nodes[leaf].parent = new_parent;
+
+    if (old_parent == NULL_NODE) {
+        m_root = new_parent;
+    } else if (m_nodes[old_parent].left == sibling) {
+        m_nodes[old_parent].left = new_parent;
+    } else {
+        m_nodes[old_parent].right = new_parent;
+    }
+
+    refitAncestors(new_parent);
+}
+
+void SpatialIndex::removeLeaf(int32_t leaf)
+{
+    if (leaf == m_root) {
+        m_root = NULL_NODE;
+        return;
+    }
+
+    auto parent = m_nodes[leaf].parent;
+    auto grand_parent = m_nodes[parent].parent;
+    auto sibling = m_nodes[parent].left == leaf ? m_nodes[parent].right : m_nodes[parent].left;
+
+    m_nodes[sibling].parent = grand_parent;
+    freeNode(parent);
+
+    if (grand_parent == NULL_NODE) {
+        m_root = sibling;
+        return;
+    }
+
+    if (m_nodes[grand_parent].left == parent) {
+        m_nodes[grand_parent].left = sibling;
+    } else {
+        m_nodes[grand_parent].right = sibling;
+    }
+
+    refitAncestors(grand_parent);
+}
+
+int32_t SpatialIndex::findSibling(const aabb_t& bounds) const
+{
+    auto index = m_root;
+
+    while (!m_nodes[index].isLeaf()) {
+        const auto& node = m_nodes[index];
+
+        float combined_area = node.bounds.merged(bounds).area();
+        float cost = 2.0f * combined_area;
+        float inheritance_cost = 2.0f * (combined_area - node.bounds.area());
+
+        auto child_cost = [&](int32_t child) {
+            const auto& child_node = m_nodes[child];
+            float       area = child_node.bounds.merged(bounds).area();
+            return child_node.isLeaf() ? area + inheritance_cost
+                                       : area - child_node.bounds.area() + inheritance_cost;
+        };
+
+        float left_cost = child_cost(node.left);
+        float right_cost = child_cost(node.right);
+
+        if (cost < left_cost && cost < right_cost) {
+            break;
+        }
+
+        index = left_cost < right_cost ? node.left : node.right;
+    }
+
+    return index;
+}
+
+void SpatialIndex::refitAncestors(int32_t node)
+{
+    auto index = node;
+
+    while (index != NULL_NODE) {
+        index = balance(index);
+
+        auto&       current = m_nodes[index];
+        const auto& left = m_nodes[current.left];
+        const auto& right = m_nodes[current.right];
+
+        current.height = 1 + std::max(left.height, right.height);
+        current.bounds = left.bounds.merged(right.bounds);
+
+        index = current.parent;
+    }
+}
+
+int32_t SpatialIndex::balance(int32_t node)
+{
+    auto& a = m_nodes[node];
+    if (a.isLeaf() || a.height < 2) {
+        return node;
+    }
+
+    auto  b_index = a.left;
+    auto  c_index = a.right;
+    auto& b = m_nodes[b_index];
+    auto& c = m_nodes[c_index];
+
+    auto replace_in_parent = [this, node](int32_t parent, int32_t child) {
+        if (parent == NULL_NODE) {
+            m_root = child;
+        } else if (m_nodes[parent].left == node) {
+            m_nodes[parent].left = child;
+        } else {
+            m_nodes[parent].right = child;
+        }
+    };
+
+    int32_t balance_factor = c.height - b.height;
+
+    if (balance_factor > 1) {
+        auto  f_index = c.left;
+        auto  g_index = c.right;
+        auto& f = m_nodes[f_index];
+        auto& g = m_nodes[g_index];
+
+        c.left = node;
+        c.parent = a.parent;
+        a.parent = c_index;
+        replace_in_parent(c.parent, c_index);
+
+        if (f.height > g.height) {
+            c.right = f_index;
+            a.right = g_index;
+            g.parent = node;
+            a.bounds = b.bounds.merged(g.bounds);
+            c.bounds = a.bounds.merged(f.bounds);
+            a.height = 1 + std::max(b.height, g.height);
+            c.height = 1 + std::max(a.height, f.height);
+        } else {
+            c.right = g_index;
+            a.right = f_index;
+            f.parent = node;
+            a.bounds = b.bounds.merged(f.bounds);
+            c.bounds = a.bounds.merged(g.bounds);
+            a.height = 1 + std::max(b.height, f.height);
+            c.height = 1 + std::max(a.height, g.height);
+        }
+
+        return c_index;
+    }
+
+    if (balance_factor < -1) {
+        auto  d_index = b.left;
+        auto  e_index = b.right;
+        auto& d = m_nodes[d_index];
+        auto& e = m_nodes[e_index];
+
+        b.left = node;
+        b.parent = a.parent;
+        a.parent = b_index;
+        replace_in_parent(b.parent, b_index);
+
+        if (d.height > e.height) {
+            b.right = d_index;
+            a.left = e_index;
+            e.parent = node;
+            a.bounds = c.bounds.merged(e.bounds);
+            b.bounds = a.bounds.merged(d.bounds);
+            a.height = 1 + std::max(c.height, e.height);
+            b.height = 1 + std::max(a.height, d.height);
+        } else {
+            b.right = e_index;
+            a.left = d_index;
+            d.parent = node;
+            a.bounds = c.bounds.merged(d.bounds);
+            b.bounds = a.bounds.merged(e.bounds);
+            a.height = 1 + std::max(c.height, d.height);
+            b.height = 1 + std::max(a.height, e.height);
+        }
+
+        return b_index;
+    }
+
+    return node;
+}
+
+} // namespace GE::Scene
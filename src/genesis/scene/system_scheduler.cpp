@@ -0,0 +1,195 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2024, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "system_scheduler.h"
+
+#include <algorithm>
+
+namespace GE::Scene {
+namespace {
+
+template<typename Container, typename Predicate>
+bool containsIf(const Container& container, Predicate&& predicate)
+{
+    return std::any_of(container.cbegin(), container.cend(), std::forward<Predicate>(predicate));
+}
+
+} // namespace
+
+bool ComponentAccess::conflictsWith(const ComponentAccess& other) const
+{
+    auto intersects = [](const auto& lhs, const auto& rhs) {
+        return containsIf(lhs, [&rhs](const auto& lhs_component) {
+            return containsIf(rhs, [&lhs_component](const auto& rhs_component) {
+                return lhs_component.id == rhs_component.id;
+            });
+        });
+    };
+
+    return intersects(m_writes, other.m_writes) || intersects(m_writes, other.m_reads) ||
+           intersects(m_reads, other.m_writes);
+}
+
+void ComponentAccess::prepareStorage(Scene* scene) const
+{
+    for (const auto& component : m_reads) {
+        component.prepare_storage(scene);
+    }
+
+    for (const auto& component : m_writes) {
+        component.prepare_storage(scene);
+    }
+}
+
+SystemScheduler::SystemScheduler(uint32_t worker_count)
+    : m_jobs{worker_count}
+    , m_commands(m_jobs.workerCount())
+{}
+
+void SystemScheduler::addSystem(std::string name, ComponentAccess access, System system)
+{
+    m_systems.push_back({std::move(name), std::move(access), std::move(system), m_phase});
+    m_is_dirty = true;
+}
+
+void SystemScheduler::addSyncPoint()
+{
+    m_phase++;
+    m_is_dirty = true;
+}
+
+void SystemScheduler::run(Scene* scene, Timestamp ts)
+{
+    if (m_is_dirty) {
+        buildBatches();
+    }
+
+    for (const auto& system : m_systems) {
+        system.access.prepareStorage(scene);
+    }
+
+    for (const auto& batch : m_batches) {
+        runBatch(batch, scene, ts);
+
+        if (batch.is_sync_point) {
+            applyCommands(scene);
+        }
+    }
+}
+
+std::vector<std::vector<std::string>> SystemScheduler::batches()
+{
+    if (m_is_dirty) {
+        buildBatches();
+    }
+
+    std::vector<std::vector<std::string>> names(m_batches.size());
+
+    for (size_t i{0}; i < m_batches.size(); i++) {
+        for (auto system : m_batches[i].systems) {
+            names[i].push_back(m_systems[system].name);
+        }
+    }
+
+    return names;
+}
+
+// A system goes to the batch after the last one with a conflicting system of the same phase,
+// while a sync point starts a new batch for the next phase
+void SystemScheduler::buildBatches()
+{
+    m_batches.clear();
+
+    std::vector<uint32_t> levels(m_systems.size());
+    uint32_t              phase_begin_level{0};
+    uint32_t              phase_begin_system{0};
+
+    for (uint32_t i{0}; i < m_systems.size(); i++) {
+        if (i > 0 && m_systems[i].phase != m_systems[i - 1].phase) {
+            m_batches.back().is_sync_point = true;
+            phase_begin_level = static_cast<uint32_t>(m_batches.size());
+            phase_begin_system = i;
+        }
+
+        uint32_t level{phase_begin_level};
+
+        for (uint32_t j{phase_begin_system}; j < i; j++) {
+            if (m_systems[i].access.conflictsWith(m_systems[j].access)) {
+                level = std::max(level, levels[j] + 1);
+            }
+        }
+
+        levels[i] = level;
+
+        if (level == m_batches.size()) {
+            m_batches.emplace_back();
+        }
+
+        m_batches[level].systems.push_back(i);
+    }
+
+    if (!m_batches.empty()) {
+        m_batches.back().is_sync_point = true;
+    }
+
+    m_is_dirty = false;
+}
+
+void SystemScheduler::runBatch(const batch_t& batch, Scene* scene, Timestamp ts)
+{
+    system_context_t ctx{scene, &m_jobs, m_commands, ts};
+
+    if (batch.systems.size() == 1) {
+        m_systems[batch.systems.front()].system(ctx);
+        return;
+    }
+
+    JobSystem::Counter counter;
+
+    for (auto system : batch.systems) {
+        m_jobs.run(
+            [this, ctx, system](uint32_t worker_index) mutable {
+                ctx.worker_index = worker_index;
+                m_systems[system].system(ctx);
+            },
+            &counter);
+    }
+
+    m_jobs.wait(counter);
+}
+
+void SystemScheduler::applyCommands(Scene* scene)
+{
+    CommandBuffer::playback(scene, m_commands);
+}
+
+} // namespace GE::Scene
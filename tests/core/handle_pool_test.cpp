@@ -0,0 +1,125 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2024, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "genesis/core/handle_pool.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+
+namespace {
+
+class HandlePoolTest: public testing::Test
+{
+protected:
+    GE::HandlePool<int> pool;
+};
+
+TEST_F(HandlePoolTest, ResolvesInsertedObjects)
+{
+    auto first = pool.insert(GE::makeShared<int>(1));
+    auto second = pool.insert(GE::makeShared<int>(2));
+
+    ASSERT_NE(pool.get(first), nullptr);
+    ASSERT_NE(pool.get(second), nullptr);
+    EXPECT_EQ(*pool.get(first), 1);
+    EXPECT_EQ(*pool.get(second), 2);
+    EXPECT_EQ(pool.size(), 2);
+}
+
+TEST_F(HandlePoolTest, NullHandle)
+{
+    GE::Handle<int> handle;
+
+    EXPECT_TRUE(handle.isNull());
+    EXPECT_EQ(pool.get(handle), nullptr);
+    EXPECT_TRUE(pool.insert(nullptr).isNull());
+}
+
+TEST_F(HandlePoolTest, ReleasedHandleResolvesToNull)
+{
+    auto object = GE::makeShared<int>(1);
+    auto handle = pool.insert(object);
+
+    pool.release(handle);
+
+    EXPECT_EQ(pool.get(handle), nullptr);
+    EXPECT_FALSE(pool.isAlive(handle));
+    EXPECT_EQ(object.use_count(), 1);
+    EXPECT_EQ(pool.size(), 0);
+}
+
+TEST_F(HandlePoolTest, ReusedSlotDoesNotResolveStaleHandle)
+{
+    auto stale = pool.insert(GE::makeShared<int>(1));
+    pool.release(stale);
+    auto fresh = pool.insert(GE::makeShared<int>(2));
+
+    EXPECT_EQ(fresh.index, stale.index);
+    EXPECT_NE(fresh, stale);
+    EXPECT_EQ(pool.get(stale), nullptr);
+    ASSERT_NE(pool.get(fresh), nullptr);
+    EXPECT_EQ(*pool.get(fresh), 2);
+
+    pool.release(stale);
+    EXPECT_TRUE(pool.isAlive(fresh));
+}
+
+TEST_F(HandlePoolTest, ResolvesInBulk)
+{
+    auto first = pool.insert(GE::makeShared<int>(1));
+    auto released = pool.insert(GE::makeShared<int>(2));
+    pool.release(released);
+
+    std::array<GE::Handle<int>, 3> handles{first, released, {}};
+    std::array<int*, 3>            objects{};
+    pool.get(handles, objects);
+
+    ASSERT_NE(objects[0], nullptr);
+    EXPECT_EQ(*objects[0], 1);
+    EXPECT_EQ(objects[1], nullptr);
+    EXPECT_EQ(objects[2], nullptr);
+}
+
+TEST_F(HandlePoolTest, Clear)
+{
+    auto first = pool.insert(GE::makeShared<int>(1));
+    auto second = pool.insert(GE::makeShared<int>(2));
+
+    pool.clear();
+
+    EXPECT_EQ(pool.size(), 0);
+    EXPECT_EQ(pool.get(first), nullptr);
+    EXPECT_EQ(pool.get(second), nullptr);
+}
+
+} // namespace
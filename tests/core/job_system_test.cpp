@@ -0,0 +1,229 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2024, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "genesis/core/job_system.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <vector>
+
+namespace {
+
+class JobSystemTest: public testing::TestWithParam<uint32_t>
+{};
+
+TEST_P(JobSystemTest, ProcessesEveryItemOnce)
+{
+    constexpr uint32_t ITEM_COUNT{1000};
+
+    GE::JobSystem                      jobs{GetParam()};
+    GE::JobSystem::Counter             counter;
+    std::vector<std::atomic<uint32_t>> visits(ITEM_COUNT);
+
+    jobs.parallelFor(
+        ITEM_COUNT, 16,
+        [&visits](uint32_t begin, uint32_t end, auto) {
+            for (uint32_t i{begin}; i < end; i++) {
+                visits[i]++;
+            }
+        },
+        &counter);
+    jobs.wait(counter);
+
+    for (const auto& visit : visits) {
+        EXPECT_EQ(visit.load(), 1);
+    }
+}
+
+TEST_P(JobSystemTest, UsesValidWorkerIndices)
+{
+    GE::JobSystem          jobs{GetParam()};
+    GE::JobSystem::Counter counter;
+    std::atomic<uint32_t>  invalid_indices{0};
+
+    jobs.parallelFor(
+        256, 1,
+        [&](uint32_t, uint32_t, uint32_t worker_index) {
+            if (worker_index >= jobs.workerCount()) {
+                invalid_indices++;
+            }
+        },
+        &counter);
+    jobs.wait(counter);
+
+    EXPECT_EQ(invalid_indices.load(), 0);
+}
+
+TEST_P(JobSystemTest, RespectsMinimalRange)
+{
+    GE::JobSystem          jobs{GetParam()};
+    GE::JobSystem::Counter counter;
+    std::atomic<uint32_t>  short_ranges{0};
+
+    jobs.parallelFor(
+        100, 30,
+        [&short_ranges](uint32_t begin, uint32_t end, auto) {
+            // Only the tail range may be shorter than requested
+            if (end - begin < 30 && end != 100) {
+                short_ranges++;
+            }
+        },
+        &counter);
+    jobs.wait(counter);
+
+    EXPECT_EQ(short_ranges.load(), 0);
+}
+
+TEST_P(JobSystemTest, CompletesEmptyRange)
+{
+    GE::JobSystem          jobs{GetParam()};
+    GE::JobSystem::Counter counter;
+
+    jobs.parallelFor(0, 1, [](auto, auto, auto) { FAIL(); }, &counter);
+    jobs.wait(counter);
+
+    EXPECT_TRUE(counter.isDone());
+}
+
+TEST_P(JobSystemTest, RunsJobsAfterDependency)
+{
+    constexpr uint32_t ITEM_COUNT{512};
+
+    GE::JobSystem          jobs{GetParam()};
+    GE::JobSystem::Counter first;
+    GE::JobSystem::Counter second;
+    std::vector<uint32_t>  values(ITEM_COUNT, 0);
+    std::atomic<uint32_t>  unordered_items{0};
+
+    jobs.parallelFor(
+        ITEM_COUNT, 8,
+        [&values](uint32_t begin, uint32_t end, auto) {
+            for (uint32_t i{begin}; i < end; i++) {
+                values[i] = i;
+            }
+        },
+        &first);
+    jobs.parallelFor(
+        ITEM_COUNT, 8,
+        [&](uint32_t begin, uint32_t end, auto) {
+            for (uint32_t i{begin}; i < end; i++) {
+                // Reading a neighbour's item checks that the whole first pass has finished
+                if (values[ITEM_COUNT - i - 1] != ITEM_COUNT - i - 1) {
+                    unordered_items++;
+                }
+            }
+        },
+        &second, &first);
+    jobs.wait(second);
+
+    EXPECT_TRUE(first.isDone());
+    EXPECT_EQ(unordered_items.load(), 0);
+}
+
+TEST_P(JobSystemTest, RunsDependencyChain)
+{
+    constexpr uint32_t CHAIN_LENGTH{64};
+
+    GE::JobSystem                       jobs{GetParam()};
+    std::vector<GE::JobSystem::Counter> counters(CHAIN_LENGTH);
+    std::vector<uint32_t>               order;
+
+    for (uint32_t i{0}; i < CHAIN_LENGTH; i++) {
+        auto* dependency = i > 0 ? &counters[i - 1] : nullptr;
+        jobs.run([&order, i](auto) { order.push_back(i); }, &counters[i], dependency);
+    }
+
+    jobs.wait(counters.back());
+
+    ASSERT_EQ(order.size(), CHAIN_LENGTH);
+    for (uint32_t i{0}; i < CHAIN_LENGTH; i++) {
+        EXPECT_EQ(order[i], i);
+    }
+}
+
+TEST_P(JobSystemTest, WaitsForNestedJobs)
+{
+    constexpr uint32_t OUTER_COUNT{16};
+    constexpr uint32_t INNER_COUNT{64};
+
+    GE::JobSystem          jobs{GetParam()};
+    GE::JobSystem::Counter counter;
+    std::atomic<uint32_t>  inner_items{0};
+
+    // Waiting inside a job must not block the worker, which executes pending jobs instead
+    jobs.parallelFor(
+        OUTER_COUNT, 1,
+        [&](uint32_t begin, uint32_t end, auto) {
+            for (uint32_t i{begin}; i < end; i++) {
+                GE::JobSystem::Counter inner_counter;
+                jobs.parallelFor(
+                    INNER_COUNT, 1,
+                    [&inner_items](uint32_t begin, uint32_t end, auto) {
+                        inner_items += end - begin;
+                    },
+                    &inner_counter);
+                jobs.wait(inner_counter);
+            }
+        },
+        &counter);
+    jobs.wait(counter);
+
+    EXPECT_EQ(inner_items.load(), OUTER_COUNT * INNER_COUNT);
+}
+
+TEST_P(JobSystemTest, StressManySmallJobs)
+{
+    constexpr uint32_t ROUND_COUNT{200};
+    constexpr uint32_t JOB_COUNT{100};
+
+    GE::JobSystem         jobs{GetParam()};
+    std::atomic<uint32_t> executed{0};
+
+    for (uint32_t round{0}; round < ROUND_COUNT; round++) {
+        GE::JobSystem::Counter counter;
+        GE::JobSystem::Counter follow_up;
+
+        for (uint32_t i{0}; i < JOB_COUNT; i++) {
+            jobs.run([&executed](auto) { executed++; }, &counter);
+        }
+
+        jobs.run([&executed](auto) { executed++; }, &follow_up, &counter);
+        jobs.wait(follow_up);
+    }
+
+    EXPECT_EQ(executed.load(), ROUND_COUNT * (JOB_COUNT + 1));
+}
+
+INSTANTIATE_TEST_SUITE_P(WorkerCounts, JobSystemTest, testing::Values(1, 2, 4, 8));
+
+} // namespace
@@ -0,0 +1,102 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2024, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "genesis/core/string_table.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <thread>
+#include <vector>
+
+namespace {
+
+class StringTableTest: public testing::Test
+{};
+
+TEST_F(StringTableTest, InternsEqualStringsOnce)
+{
+    std::string first{"string_table_test.first"};
+    std::string first_copy{first};
+
+    auto id = GE::StringTable::intern(first);
+
+    EXPECT_EQ(GE::StringTable::intern(first_copy), id);
+    EXPECT_NE(GE::StringTable::intern("string_table_test.second"), id);
+    EXPECT_EQ(GE::StringTable::string(id), first);
+}
+
+TEST_F(StringTableTest, EmptyString)
+{
+    EXPECT_EQ(GE::StringTable::intern(""), GE::StringTable::EMPTY_ID);
+    EXPECT_TRUE(GE::StringTable::string(GE::StringTable::EMPTY_ID).empty());
+}
+
+TEST_F(StringTableTest, StringsStayValidWhileTableGrows)
+{
+    auto        id = GE::StringTable::intern("string_table_test.stable");
+    const auto& string = GE::StringTable::string(id);
+
+    for (int i{0}; i < 1000; ++i) {
+        GE::StringTable::intern("string_table_test.grow." + std::to_string(i));
+    }
+
+    EXPECT_EQ(string, "string_table_test.stable");
+}
+
+TEST_F(StringTableTest, ConcurrentInterning)
+{
+    constexpr size_t THREAD_COUNT{4};
+    constexpr size_t STRING_COUNT{500};
+
+    std::array<std::vector<GE::StringTable::ID>, THREAD_COUNT> ids;
+    std::vector<std::thread>                                   threads;
+
+    for (size_t thread{0}; thread < THREAD_COUNT; ++thread) {
+        threads.emplace_back([&ids, thread] {
+            for (size_t i{0}; i < STRING_COUNT; ++i) {
+                ids[thread].push_back(
+                    GE::StringTable::intern("string_table_test.concurrent." + std::to_string(i)));
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (size_t thread{1}; thread < THREAD_COUNT; ++thread) {
+        EXPECT_EQ(ids[thread], ids[0]);
+    }
+}
+
+} // namespace
@@ -0,0 +1,230 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2024, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "genesis/scene/command_buffer.h"
+#include "genesis/scene/components.h"
+#include "genesis/scene/entity_node.h"
+#include "genesis/scene/scene.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <thread>
+
+using namespace GE::Scene;
+using namespace testing;
+
+namespace {
+
+class CommandBufferTest: public Test
+{
+protected:
+    static std::vector<std::string> siblingTags(EntityNode node)
+    {
+        std::vector<std::string> tags;
+
+        for (; !node.isNull(); node = node.nextNode()) {
+            tags.push_back(node.entity().get<TagComponent>().tag());
+        }
+
+        return tags;
+    }
+
+    static std::vector<std::string> childTags(const Entity& entity)
+    {
+        return siblingTags(EntityNode{entity}.childNode());
+    }
+
+    std::vector<std::string> topLevelTags() const
+    {
+        return siblingTags(EntityNode{scene.headEntity()});
+    }
+
+    Scene         scene;
+    CommandBuffer commands;
+};
+
+TEST_F(CommandBufferTest, CreatesEntitiesAfterTail)
+{
+    scene.createEntity("existing");
+
+    auto camera = commands.createEntity("camera");
+    commands.createEntity("sprite");
+    commands.addComponent<CameraComponent>(camera);
+
+    EXPECT_THAT(topLevelTags(), ElementsAre("existing"));
+    commands.playback(&scene);
+
+    EXPECT_THAT(topLevelTags(), ElementsAre("existing", "camera", "sprite"));
+    EXPECT_EQ(scene.tailEnity(), scene.findEntity("sprite"));
+    EXPECT_TRUE(scene.findEntity("camera").has<CameraComponent>());
+    EXPECT_TRUE(commands.empty());
+}
+
+TEST_F(CommandBufferTest, BatchesComponentCommandsOfAllBuffers)
+{
+    auto first = scene.createEntity("first");
+    auto second = scene.createEntity("second");
+    EntityNode{first}.insert(second);
+
+    std::vector<CommandBuffer> buffers(2);
+    buffers[0].addComponent<BoxCollider2DComponent>(first);
+    buffers[1].addComponent<BoxCollider2DComponent>(second);
+    buffers[0].setComponent<TagComponent>(first, {"renamed"});
+    buffers[1].removeComponent<TransformComponent>(second);
+
+    CommandBuffer::playback(&scene, buffers);
+
+    EXPECT_TRUE(first.has<BoxCollider2DComponent>());
+    EXPECT_TRUE(second.has<BoxCollider2DComponent>());
+    EXPECT_FALSE(second.has<TransformComponent>());
+    EXPECT_EQ(scene.findEntity("renamed"), first);
+    EXPECT_TRUE(scene.findEntity("first").isNull());
+}
+
+TEST_F(CommandBufferTest, AddsReplaceExistingComponents)
+{
+    auto entity = scene.createEntity("entity");
+
+    BoxCollider2DComponent shown_collider;
+    shown_collider.show_collider = true;
+
+    std::vector<CommandBuffer> buffers(2);
+    buffers[0].addComponent<BoxCollider2DComponent>(entity);
+    buffers[1].addComponent<BoxCollider2DComponent>(entity, shown_collider);
+    buffers[1].addComponent<TagComponent>(entity, {"renamed"});
+
+    CommandBuffer::playback(&scene, buffers);
+
+    ASSERT_TRUE(entity.has<BoxCollider2DComponent>());
+    EXPECT_TRUE(entity.get<BoxCollider2DComponent>().show_collider);
+    EXPECT_EQ(scene.findEntity("renamed"), entity);
+
+    commands.addComponent<BoxCollider2DComponent>(entity);
+    commands.playback(&scene);
+
+    EXPECT_FALSE(entity.get<BoxCollider2DComponent>().show_collider);
+}
+
+TEST_F(CommandBufferTest, ReparentsCreatedEntities)
+{
+    auto parent = commands.createEntity("parent");
+    auto child = commands.createEntity("child");
+    commands.reparent(child, parent);
+    commands.playback(&scene);
+
+    auto parent_entity = scene.findEntity("parent");
+    EXPECT_THAT(topLevelTags(), ElementsAre("parent"));
+    EXPECT_THAT(childTags(parent_entity), ElementsAre("child"));
+
+    commands.reparent(scene.findEntity("child"), Entity{});
+    commands.playback(&scene);
+
+    EXPECT_THAT(topLevelTags(), ElementsAre("parent", "child"));
+    EXPECT_THAT(childTags(parent_entity), IsEmpty());
+}
+
+TEST_F(CommandBufferTest, DestroysSubtrees)
+{
+    auto root = scene.createEntity("root");
+    auto child = scene.createEntity("child");
+    EntityNode{root}.appendChild(child);
+    EntityNode{root}.appendChild(scene.createEntity("second child"));
+    EntityNode{root}.insert(scene.createEntity("sibling"));
+
+    commands.destroyEntity(child);
+    commands.destroyEntity(root);
+    commands.playback(&scene);
+
+    EXPECT_THAT(topLevelTags(), ElementsAre("sibling"));
+    EXPECT_EQ(scene.headEntity(), scene.findEntity("sibling"));
+    EXPECT_EQ(scene.nameIndex().size(), 1);
+}
+
+TEST_F(CommandBufferTest, SkipsDestroyedEntities)
+{
+    auto entity = scene.createEntity("entity");
+    auto sibling = scene.createEntity("sibling");
+    EntityNode{entity}.insert(sibling);
+
+    std::vector<CommandBuffer> buffers(2);
+    buffers[0].addComponent<BoxCollider2DComponent>(entity);
+    buffers[1].destroyEntity(entity);
+
+    CommandBuffer::playback(&scene, buffers);
+
+    EXPECT_THAT(topLevelTags(), ElementsAre("sibling"));
+
+    buffers[0].addComponent<BoxCollider2DComponent>(entity);
+    buffers[0].setComponent<TagComponent>(entity, {"renamed"});
+    buffers[0].removeComponent<TransformComponent>(entity);
+    buffers[0].addComponent<BoxCollider2DComponent>(sibling);
+    buffers[1].reparent(sibling, entity);
+    buffers[1].destroyEntity(entity);
+
+    CommandBuffer::playback(&scene, buffers);
+
+    EXPECT_THAT(topLevelTags(), ElementsAre("sibling"));
+    EXPECT_TRUE(sibling.has<BoxCollider2DComponent>());
+    EXPECT_TRUE(scene.findEntity("renamed").isNull());
+}
+
+TEST_F(CommandBufferTest, RecordsOnSeveralThreads)
+{
+    constexpr uint32_t THREAD_COUNT{4};
+    constexpr uint32_t ENTITY_COUNT{1000};
+
+    std::vector<CommandBuffer> buffers(THREAD_COUNT);
+    std::vector<std::thread>   threads;
+
+    for (auto& buffer : buffers) {
+        threads.emplace_back([&buffer] {
+            for (uint32_t i{0}; i < ENTITY_COUNT; i++) {
+                buffer.addComponent<BoxCollider2DComponent>(buffer.createEntity());
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    CommandBuffer::playback(&scene, buffers);
+
+    uint32_t count{0};
+    scene.forEach<BoxCollider2DComponent>([&count](const auto&) { count++; });
+
+    EXPECT_EQ(count, THREAD_COUNT * ENTITY_COUNT);
+    EXPECT_EQ(topLevelTags().size(), THREAD_COUNT * ENTITY_COUNT);
+}
+
+} // namespace
@@ -45,8 +45,8 @@ MATCHER_P(isTagComponent,
 {
     using testing::ExplainMatchResult;
 
-    if (!ExplainMatchResult(tag, arg.tag, result_listener)) {
-        *result_listener << "actual tag: '" << arg.tag << "'";
+    if (!ExplainMatchResult(tag, arg.tag(), result_listener)) {
+        *result_listener << "actual tag: '" << arg.tag() << "'";
         return false;
     }
 
@@ -0,0 +1,144 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2024, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "genesis/core/log.h"
+#include "genesis/filesystem/filepath.h"
+#include "genesis/filesystem/tmp_dir_guard.h"
+#include "genesis/scene/headless_runner.h"
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace GE::Scene;
+using namespace testing;
+
+namespace {
+
+constexpr std::string_view SCENE_FILE = R"(
+scene:
+  name: "FallingBox"
+  serialization_version: 1
+  entities:
+    - components:
+        - type: Tag
+          tag: "ground"
+        - type: Transform
+          translation: [0.0, -2.0, 0.0]
+          rotation: [0.0, 0.0, 0.0]
+          scale: [10.0, 1.0, 1.0]
+        - type: Rigidbody 2D
+          body_type: STATIC
+          fixed_rotation: false
+        - type: Box Collider 2D
+          base_shape: {friction: 0.5, restitution: 0.0, density: 1.0}
+          size: [1.0, 1.0]
+          center: [0.0, 0.0]
+          angle: 0.0
+          show_collider: false
+    - components:
+        - type: Tag
+          tag: "box"
+        - type: Transform
+          translation: [0.3, 3.0, 0.0]
+          rotation: [0.0, 0.0, 0.4]
+          scale: [1.0, 1.0, 1.0]
+        - type: Rigidbody 2D
+          body_type: DYNAMIC
+          fixed_rotation: false
+        - type: Box Collider 2D
+          base_shape: {friction: 0.5, restitution: 0.2, density: 1.0}
+          size: [1.0, 1.0]
+          center: [0.0, 0.0]
+          angle: 0.0
+          show_collider: false
+)";
+
+class HeadlessRunnerTest: public Test
+{
+protected:
+    static void SetUpTestCase()
+    {
+        GE::Log::initialize({GE::Logger::Level::ERROR, GE::Logger::Level::ERROR});
+    }
+
+    HeadlessRunnerTest()
+    {
+        config.scene_filepath = GE::FS::joinPath(tmp_dir.path(), "scene.yaml");
+        config.tick_count = 120;
+
+        std::ofstream file{config.scene_filepath};
+        file << SCENE_FILE;
+    }
+
+    GE::FS::TmpDirGuard      tmp_dir;
+    HeadlessRunner::config_t config;
+};
+
+TEST_F(HeadlessRunnerTest, SimulatesScene)
+{
+    auto initial_config = config;
+    initial_config.tick_count = 0;
+
+    auto initial_report = HeadlessRunner{initial_config}.run();
+    auto report = HeadlessRunner{config}.run();
+
+    ASSERT_TRUE(report.is_loaded);
+    EXPECT_EQ(report.tick_count, config.tick_count);
+    EXPECT_NE(report.state_hash, initial_report.state_hash);
+}
+
+TEST_F(HeadlessRunnerTest, ParallelInstancesAreIndependent)
+{
+    std::vector<HeadlessRunner::config_t> configs(8, config);
+    auto                                  reports = HeadlessRunner::runParallel(configs, 4);
+
+    ASSERT_EQ(reports.size(), configs.size());
+
+    for (const auto& report : reports) {
+        ASSERT_TRUE(report.is_loaded);
+        EXPECT_EQ(report.tick_count, config.tick_count);
+        EXPECT_EQ(report.state_hash, reports.front().state_hash);
+    }
+}
+
+TEST_F(HeadlessRunnerTest, ReportsMissingScene)
+{
+    auto report = HeadlessRunner{{.scene_filepath = "missing.yaml"}}.run();
+
+    EXPECT_FALSE(report.is_loaded);
+    EXPECT_EQ(report.tick_count, 0);
+}
+
+} // namespace
@@ -0,0 +1,138 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2024, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "genesis/scene/components/tag_component.h"
+#include "genesis/scene/name_index.h"
+#include "genesis/scene/scene.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <string>
+
+using namespace GE::Scene;
+using namespace testing;
+
+namespace {
+
+std::vector<Entity::NativeHandle> searchAll(const NameIndex& index, std::string_view pattern)
+{
+    std::vector<Entity::NativeHandle> entities;
+    index.search(pattern, [&entities](auto entity) { entities.push_back(entity); });
+    return entities;
+}
+
+class NameIndexTest: public Test
+{
+protected:
+    void SetUp() override
+    {
+        index.insert(Entity::NativeHandle{1}, "Player");
+        index.insert(Entity::NativeHandle{2}, "Enemy");
+        index.insert(Entity::NativeHandle{3}, "Enemy");
+        index.insert(Entity::NativeHandle{4}, "Main Camera");
+    }
+
+    NameIndex index;
+};
+
+TEST_F(NameIndexTest, FindByExactName)
+{
+    EXPECT_EQ(index.find("Player"), Entity::NativeHandle{1});
+    EXPECT_EQ(index.find("player"), Entity::NativeHandle{Entity::NULL_ID});
+    EXPECT_THAT(index.findAll("Enemy"),
+                UnorderedElementsAre(Entity::NativeHandle{2}, Entity::NativeHandle{3}));
+    EXPECT_THAT(index.findAll("Unknown"), IsEmpty());
+}
+
+TEST_F(NameIndexTest, SearchSubstringIgnoringCase)
+{
+    EXPECT_THAT(searchAll(index, "ENEM"),
+                UnorderedElementsAre(Entity::NativeHandle{2}, Entity::NativeHandle{3}));
+    EXPECT_THAT(searchAll(index, "n camer"), ElementsAre(Entity::NativeHandle{4}));
+    EXPECT_THAT(searchAll(index, "ay"), ElementsAre(Entity::NativeHandle{1}));
+    EXPECT_THAT(searchAll(index, "P"), ElementsAre(Entity::NativeHandle{1}));
+    EXPECT_THAT(searchAll(index, "camera man"), IsEmpty());
+    EXPECT_THAT(searchAll(index, "xyz"), IsEmpty());
+}
+
+TEST_F(NameIndexTest, RenameAndRemove)
+{
+    index.insert(Entity::NativeHandle{2}, "Boss");
+    index.remove(Entity::NativeHandle{3});
+
+    EXPECT_EQ(index.size(), 3);
+    EXPECT_FALSE(index.contains(Entity::NativeHandle{3}));
+    EXPECT_EQ(index.find("Boss"), Entity::NativeHandle{2});
+    EXPECT_THAT(index.findAll("Enemy"), IsEmpty());
+    EXPECT_THAT(searchAll(index, "enemy"), IsEmpty());
+    EXPECT_THAT(searchAll(index, "bos"), ElementsAre(Entity::NativeHandle{2}));
+}
+
+TEST_F(NameIndexTest, RenamingBackAndForthKeepsResultsUnique)
+{
+    constexpr int RENAME_COUNT{5000};
+
+    for (int i{0}; i < RENAME_COUNT; i++) {
+        index.insert(Entity::NativeHandle{1}, i % 2 == 0 ? "Hero" : "Player");
+    }
+
+    EXPECT_THAT(searchAll(index, "player"), ElementsAre(Entity::NativeHandle{1}));
+    EXPECT_THAT(searchAll(index, "hero"), IsEmpty());
+    EXPECT_THAT(searchAll(index, "enemy"),
+                UnorderedElementsAre(Entity::NativeHandle{2}, Entity::NativeHandle{3}));
+}
+
+TEST(SceneNameIndexTest, FollowsTagChanges)
+{
+    Scene scene;
+    auto  player = scene.createEntity("player");
+    scene.createEntity("enemy");
+
+    EXPECT_EQ(scene.findEntity("player"), player);
+    EXPECT_EQ(scene.nameIndex().size(), 2);
+
+    player.patch<TagComponent>([](auto& tag) { tag.setTag("hero"); });
+    EXPECT_TRUE(scene.findEntity("player").isNull());
+    EXPECT_EQ(scene.findEntity("hero"), player);
+
+    scene.destroyEntity(player);
+    EXPECT_TRUE(scene.findEntity("hero").isNull());
+    EXPECT_EQ(scene.nameIndex().size(), 1);
+
+    Scene moved_scene{std::move(scene)};
+    auto  camera = moved_scene.createEntity("camera");
+    EXPECT_EQ(moved_scene.findEntity("camera"), camera);
+    EXPECT_FALSE(moved_scene.findEntity("enemy").isNull());
+}
+
+} // namespace
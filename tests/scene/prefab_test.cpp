@@ -0,0 +1,184 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2024, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "genesis/scene/components.h"
+#include "genesis/scene/entity_node.h"
+#include "genesis/scene/prefab.h"
+#include "genesis/scene/scene.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+using namespace GE::Scene;
+using namespace testing;
+
+namespace {
+
+class PrefabTest: public Test
+{
+protected:
+    void SetUp() override
+    {
+        auto root = source.createEntity("root");
+        auto first_child = source.createEntity("first child");
+        auto second_child = source.createEntity("second child");
+
+        EntityNode{root}.appendChild(first_child);
+        EntityNode{root}.appendChild(second_child);
+
+        root.get<TransformComponent>().translation = {1.0f, 2.0f, 3.0f};
+        second_child.add<BoxCollider2DComponent>().show_collider = true;
+    }
+
+    static std::vector<std::string> childTags(const Entity& entity)
+    {
+        std::vector<std::string> tags;
+
+        for (auto child = EntityNode{entity}.childNode(); !child.isNull();
+             child = child.nextNode()) {
+            tags.push_back(child.entity().get<TagComponent>().tag());
+        }
+
+        return tags;
+    }
+
+    static std::vector<Entity> topLevelEntities(const Scene& scene)
+    {
+        std::vector<Entity> entities;
+
+        for (auto node = EntityNode{scene.headEntity()}; !node.isNull(); node = node.nextNode()) {
+            entities.push_back(node.entity());
+        }
+
+        return entities;
+    }
+
+    Scene source;
+    Scene scene;
+};
+
+TEST_F(PrefabTest, InstantiatesIntoEmptyScene)
+{
+    Prefab prefab{source};
+    auto   roots = prefab.instantiate(&scene, 3);
+
+    EXPECT_EQ(prefab.entityCount(), 3);
+    ASSERT_EQ(roots.size(), 3);
+    EXPECT_THAT(topLevelEntities(scene), ElementsAreArray(roots));
+    EXPECT_EQ(scene.tailEnity(), roots.back());
+
+    for (const auto& root : roots) {
+        EXPECT_EQ(root.get<TagComponent>().tag(), "root");
+        EXPECT_THAT(childTags(root), ElementsAre("first child", "second child"));
+
+        auto last_child = EntityNode{root}.lastChild().entity();
+        EXPECT_TRUE(last_child.get<BoxCollider2DComponent>().show_collider);
+    }
+}
+
+TEST_F(PrefabTest, InstantiatesUnderParent)
+{
+    auto parent = scene.createEntity("parent");
+    EntityNode{parent}.appendChild(scene.createEntity("existing child"));
+
+    Prefab prefab{source};
+    auto   roots = prefab.instantiate(&scene, 2, parent);
+
+    ASSERT_EQ(roots.size(), 2);
+    EXPECT_THAT(childTags(parent), ElementsAre("existing child", "root", "root"));
+    EXPECT_EQ(EntityNode{roots.front()}.parentNode().entity(), parent);
+    EXPECT_THAT(topLevelEntities(scene), ElementsAre(parent));
+}
+
+TEST_F(PrefabTest, InstancesAreIndependent)
+{
+    Prefab prefab{source};
+    auto   roots = prefab.instantiate(&scene, 2);
+
+    ASSERT_EQ(roots.size(), 2);
+    roots.front().get<TransformComponent>().translation = {5.0f, 5.0f, 5.0f};
+    roots.front().get<TagComponent>().setTag("changed");
+
+    EXPECT_EQ(roots.back().get<TransformComponent>().translation, GE::Vec3(1.0f, 2.0f, 3.0f));
+    EXPECT_EQ(roots.back().get<TagComponent>().tag(), "root");
+}
+
+TEST_F(PrefabTest, BakesSubtreeWithoutSiblings)
+{
+    auto first_child = EntityNode{source.headEntity()}.childNode().entity();
+    EntityNode{first_child}.appendChild(source.createEntity("grandchild"));
+
+    Prefab prefab{first_child};
+    auto   roots = prefab.instantiate(&scene);
+
+    EXPECT_EQ(prefab.entityCount(), 2);
+    ASSERT_EQ(roots.size(), 1);
+    EXPECT_EQ(roots.front().get<TagComponent>().tag(), "first child");
+    EXPECT_THAT(childTags(roots.front()), ElementsAre("grandchild"));
+    EXPECT_THAT(topLevelEntities(scene), ElementsAre(roots.front()));
+}
+
+TEST_F(PrefabTest, DuplicatesEntityInScene)
+{
+    auto root = source.headEntity();
+    auto second_child = EntityNode{root}.lastChild().entity();
+    auto copy = source.duplicateEntity(second_child);
+
+    ASSERT_FALSE(copy.isNull());
+    EXPECT_NE(copy, second_child);
+    EXPECT_THAT(childTags(root), ElementsAre("first child", "second child", "second child"));
+    EXPECT_TRUE(copy.get<BoxCollider2DComponent>().show_collider);
+    EXPECT_EQ(source.nameIndex().findAll("second child").size(), 2);
+}
+
+TEST_F(PrefabTest, ClonesEntityIntoAnotherScene)
+{
+    auto copy = source.cloneEntity(source.headEntity(), &scene);
+
+    ASSERT_FALSE(copy.isNull());
+    EXPECT_THAT(topLevelEntities(scene), ElementsAre(copy));
+    EXPECT_THAT(childTags(copy), ElementsAre("first child", "second child"));
+    EXPECT_EQ(copy.get<TransformComponent>().translation, GE::Vec3(1.0f, 2.0f, 3.0f));
+    EXPECT_EQ(scene.findEntity("root"), copy);
+}
+
+TEST_F(PrefabTest, EmptyPrefabCreatesNothing)
+{
+    Scene  empty_scene;
+    Prefab prefab{empty_scene};
+
+    EXPECT_EQ(prefab.entityCount(), 0);
+    EXPECT_TRUE(prefab.instantiate(&scene, 10).empty());
+    EXPECT_TRUE(scene.headEntity().isNull());
+}
+
+} // namespace
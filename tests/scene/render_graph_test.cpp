@@ -0,0 +1,156 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2024, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "genesis/scene/renderer/render_graph.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+using namespace GE;
+using namespace GE::Scene;
+using namespace testing;
+
+namespace {
+
+Framebuffer::config_t makeConfig(const Vec2& size)
+{
+    Framebuffer::config_t config{};
+    config.size = size;
+    return config;
+}
+
+void noop(GE::Renderer* /*renderer*/, RenderGraph* /*graph*/) {}
+
+class RenderGraphTest: public Test
+{
+protected:
+    RenderGraphTest()
+        : backbuffer{graph.importTarget("backbuffer", fakeRenderer())}
+    {}
+
+    static GE::Renderer* fakeRenderer()
+    {
+        return reinterpret_cast<GE::Renderer*>(0x10); // NOLINT(performance-no-int-to-ptr)
+    }
+
+    RenderGraph             graph;
+    RenderGraph::ResourceID backbuffer{0};
+};
+
+TEST_F(RenderGraphTest, CullsPassesWithoutConsumers)
+{
+    auto used = graph.createTarget("used", makeConfig({64.0f, 64.0f}));
+    auto unused = graph.createTarget("unused", makeConfig({64.0f, 64.0f}));
+
+    graph.addPass("produce_used", used, {}, Renderer::CLEAR_ALL, noop);
+    graph.addPass("produce_unused", unused, {}, Renderer::CLEAR_ALL, noop);
+    graph.addPass("present", backbuffer, {used}, Renderer::CLEAR_ALL, noop);
+
+    ASSERT_TRUE(graph.compile());
+    EXPECT_THAT(graph.executionOrder(), ElementsAre("produce_used", "present"));
+    EXPECT_EQ(graph.physicalTarget(used), 0);
+    EXPECT_EQ(graph.physicalTarget(unused), std::nullopt);
+}
+
+TEST_F(RenderGraphTest, GroupsPassesWritingSameTarget)
+{
+    auto first = graph.createTarget("first", makeConfig({64.0f, 64.0f}));
+    auto second = graph.createTarget("second", makeConfig({32.0f, 32.0f}));
+
+    graph.addPass("draw_first", first, {}, Renderer::CLEAR_ALL, noop);
+    graph.addPass("compose_first", backbuffer, {first}, Renderer::CLEAR_ALL, noop);
+    graph.addPass("draw_second", second, {}, Renderer::CLEAR_ALL, noop);
+    graph.addPass("compose_second", backbuffer, {second}, Renderer::CLEAR_NONE, noop);
+
+    ASSERT_TRUE(graph.compile());
+    EXPECT_THAT(graph.executionOrder(),
+                ElementsAre("draw_first", "draw_second", "compose_first", "compose_second"));
+}
+
+TEST_F(RenderGraphTest, AliasesCompatibleTargetsWithDisjointLifetimes)
+{
+    auto first = graph.createTarget("first", makeConfig({64.0f, 64.0f}));
+    auto intermediate = graph.createTarget("intermediate", makeConfig({32.0f, 32.0f}));
+    auto last = graph.createTarget("last", makeConfig({64.0f, 64.0f}));
+
+    graph.addPass("draw", first, {}, Renderer::CLEAR_ALL, noop);
+    graph.addPass("downsample", intermediate, {first}, Renderer::CLEAR_ALL, noop);
+    graph.addPass("upsample", last, {intermediate}, Renderer::CLEAR_ALL, noop);
+    graph.addPass("present", backbuffer, {last}, Renderer::CLEAR_ALL, noop);
+
+    ASSERT_TRUE(graph.compile());
+    EXPECT_EQ(graph.physicalTargetCount(), 2);
+    EXPECT_EQ(graph.physicalTarget(first), graph.physicalTarget(last));
+    EXPECT_NE(graph.physicalTarget(first), graph.physicalTarget(intermediate));
+}
+
+TEST_F(RenderGraphTest, KeepsTargetsWithOverlappingLifetimesApart)
+{
+    auto first = graph.createTarget("first", makeConfig({64.0f, 64.0f}));
+    auto second = graph.createTarget("second", makeConfig({64.0f, 64.0f}));
+
+    graph.addPass("draw_first", first, {}, Renderer::CLEAR_ALL, noop);
+    graph.addPass("draw_second", second, {}, Renderer::CLEAR_ALL, noop);
+    graph.addPass("present", backbuffer, {first, second}, Renderer::CLEAR_ALL, noop);
+
+    ASSERT_TRUE(graph.compile());
+    EXPECT_EQ(graph.physicalTargetCount(), 2);
+    EXPECT_NE(graph.physicalTarget(first), graph.physicalTarget(second));
+}
+
+TEST_F(RenderGraphTest, MergesOnlyLoadingPassesIntoFrame)
+{
+    auto target = graph.createTarget("target", makeConfig({64.0f, 64.0f}));
+
+    graph.addPass("opaque", target, {}, Renderer::CLEAR_ALL, noop);
+    graph.addPass("transparent", target, {}, Renderer::CLEAR_NONE, noop);
+    graph.addPass("overlay", target, {}, Renderer::CLEAR_DEPTH, noop);
+    graph.addPass("present", backbuffer, {target}, Renderer::CLEAR_ALL, noop);
+    graph.addPass("gui", backbuffer, {}, Renderer::CLEAR_NONE, noop);
+
+    ASSERT_TRUE(graph.compile());
+    EXPECT_THAT(graph.executionOrder(),
+                ElementsAre("opaque", "transparent", "overlay", "present", "gui"));
+    EXPECT_EQ(graph.frameCount(), 3);
+}
+
+TEST_F(RenderGraphTest, FailsToReadUnwrittenTarget)
+{
+    auto target = graph.createTarget("target", makeConfig({64.0f, 64.0f}));
+
+    graph.addPass("present", backbuffer, {target}, Renderer::CLEAR_ALL, noop);
+    graph.addPass("draw", target, {}, Renderer::CLEAR_ALL, noop);
+
+    EXPECT_FALSE(graph.compile());
+}
+
+} // namespace
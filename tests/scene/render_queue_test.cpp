@@ -0,0 +1,136 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2024, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "genesis/scene/renderer/render_queue.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+using namespace GE;
+using namespace GE::Scene;
+using namespace testing;
+
+namespace {
+
+template<typename T>
+T* fakeResource(uintptr_t address)
+{
+    return reinterpret_cast<T*>(address); // NOLINT(performance-no-int-to-ptr)
+}
+
+RenderQueue::item_t makeItem(uintptr_t pipeline, uintptr_t texture, float depth)
+{
+    RenderQueue::item_t item{};
+    item.pipeline = fakeResource<Pipeline>(pipeline);
+    item.texture = fakeResource<Texture>(texture);
+    item.mesh = fakeResource<Mesh>(0x100);
+    item.mvp[3][2] = depth;
+    return item;
+}
+
+std::vector<float> depths(const RenderQueue& queue, RenderQueue::Pass pass)
+{
+    std::vector<float> result;
+    queue.forEach(pass, [&result](const auto& item) { result.push_back(item.mvp[3][2]); });
+    return result;
+}
+
+std::vector<Texture*> textures(const RenderQueue& queue, RenderQueue::Pass pass)
+{
+    std::vector<Texture*> result;
+    queue.forEach(pass, [&result](const auto& item) { result.push_back(item.texture); });
+    return result;
+}
+
+class RenderQueueTest: public Test
+{
+protected:
+    RenderQueue queue;
+};
+
+TEST_F(RenderQueueTest, SplitsItemsByPass)
+{
+    queue.push(RenderQueue::Pass::TRANSPARENT_ENTITIES, makeItem(0x10, 0x20, 0.1f));
+    queue.push(RenderQueue::Pass::OPAQUE_ENTITIES, makeItem(0x10, 0x20, 0.2f));
+    queue.push(RenderQueue::Pass::TRANSPARENT_ENTITIES, makeItem(0x10, 0x20, 0.3f));
+    queue.sort();
+
+    EXPECT_THAT(depths(queue, RenderQueue::Pass::OPAQUE_ENTITIES), ElementsAre(0.2f));
+    EXPECT_THAT(depths(queue, RenderQueue::Pass::TRANSPARENT_ENTITIES), ElementsAre(0.1f, 0.3f));
+}
+
+TEST_F(RenderQueueTest, GroupsItemsByStateAndDepth)
+{
+    queue.push(RenderQueue::Pass::OPAQUE_ENTITIES, makeItem(0x10, 0x20, 0.5f));
+    queue.push(RenderQueue::Pass::OPAQUE_ENTITIES, makeItem(0x10, 0x30, 0.4f));
+    queue.push(RenderQueue::Pass::OPAQUE_ENTITIES, makeItem(0x10, 0x20, 0.1f));
+    queue.push(RenderQueue::Pass::OPAQUE_ENTITIES, makeItem(0x10, 0x30, 0.2f));
+    queue.sort();
+
+    auto* first = fakeResource<Texture>(0x20);
+    auto* second = fakeResource<Texture>(0x30);
+
+    EXPECT_THAT(textures(queue, RenderQueue::Pass::OPAQUE_ENTITIES),
+                ElementsAre(first, first, second, second));
+    EXPECT_THAT(depths(queue, RenderQueue::Pass::OPAQUE_ENTITIES),
+                ElementsAre(0.1f, 0.5f, 0.2f, 0.4f));
+}
+
+TEST_F(RenderQueueTest, ReusesOrderForUnchangedFrame)
+{
+    for (int frame = 0; frame < 2; frame++) {
+        queue.clear();
+        queue.push(RenderQueue::Pass::OPAQUE_ENTITIES, makeItem(0x10, 0x30, 0.3f));
+        queue.push(RenderQueue::Pass::OPAQUE_ENTITIES, makeItem(0x10, 0x20, 0.1f));
+        queue.sort();
+
+        EXPECT_THAT(depths(queue, RenderQueue::Pass::OPAQUE_ENTITIES), ElementsAre(0.3f, 0.1f));
+    }
+
+    queue.clear();
+    queue.push(RenderQueue::Pass::OPAQUE_ENTITIES, makeItem(0x10, 0x20, 0.1f));
+    queue.sort();
+
+    EXPECT_THAT(depths(queue, RenderQueue::Pass::OPAQUE_ENTITIES), ElementsAre(0.1f));
+}
+
+TEST(RenderQueueKeyTest, OrdersByPassFirst)
+{
+    auto opaque = RenderQueue::makeKey(RenderQueue::Pass::OPAQUE_ENTITIES, 127, 65535, 65535, 1.0f);
+    auto transparent = RenderQueue::makeKey(RenderQueue::Pass::TRANSPARENT_ENTITIES, 0, 0, 0, 0.0f);
+
+    EXPECT_LT(opaque, transparent);
+    EXPECT_LT(RenderQueue::makeKey(RenderQueue::Pass::OPAQUE_ENTITIES, 0, 0, 0, 0.25f),
+              RenderQueue::makeKey(RenderQueue::Pass::OPAQUE_ENTITIES, 0, 0, 0, 0.75f));
+}
+
+} // namespace
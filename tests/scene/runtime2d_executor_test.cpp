@@ -0,0 +1,394 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2024, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "genesis/physics2d/world.h"
+#include "genesis/scene/components.h"
+#include "genesis/scene/entity_node.h"
+#include "genesis/scene/executor/runtime2d_executor.h"
+#include "genesis/scene/scene.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace GE;
+using namespace GE::Scene;
+using namespace testing;
+
+namespace {
+
+class MockRigidBody: public P2D::RigidBody
+{
+public:
+    MOCK_METHOD(void, createShape, (const P2D::box_body_shape_config_t&), (override));
+    MOCK_METHOD(void, createShape, (const P2D::circle_body_shape_config_t&), (override));
+    MOCK_METHOD(void, setFixedRotation, (bool), (override));
+    MOCK_METHOD(void, setUserData, (uint64_t), (override));
+    MOCK_METHOD(void, setState, (const P2D::body_state_t&), (override));
+    MOCK_METHOD(bool, isFixedRotation, (), (const, override));
+    MOCK_METHOD(Vec2, position, (), (const, override));
+    MOCK_METHOD(float, angle, (), (const, override));
+    MOCK_METHOD(P2D::pose_t, pose, (), (const, override));
+    MOCK_METHOD(uint64_t, userData, (), (const, override));
+    MOCK_METHOD(P2D::body_state_t, state, (), (const, override));
+};
+
+class MockWorld: public P2D::World
+{
+public:
+    MOCK_METHOD(void, step, (Timestamp, int32_t), (override));
+    MOCK_METHOD(const std::vector<P2D::body_move_event_t>&,
+                bodyMoveEvents,
+                (),
+                (const, override));
+    MOCK_METHOD(const P2D::contact_events_t&, contactEvents, (), (const, override));
+    MOCK_METHOD(P2D::cast_hit_t, castRayClosest, (const P2D::ray_cast_t&), (const, override));
+    MOCK_METHOD(void,
+                castRay,
+                (const P2D::ray_cast_t&, std::vector<P2D::cast_hit_t>*),
+                (const, override));
+    MOCK_METHOD(P2D::cast_hit_t, castShape, (const P2D::box_cast_t&), (const, override));
+    MOCK_METHOD(P2D::cast_hit_t, castShape, (const P2D::circle_cast_t&), (const, override));
+    MOCK_METHOD(void,
+                overlap,
+                (const P2D::aabb_overlap_t&, std::vector<uint64_t>*),
+                (const, override));
+    MOCK_METHOD(void,
+                overlap,
+                (const P2D::box_overlap_t&, std::vector<uint64_t>*),
+                (const, override));
+    MOCK_METHOD(void,
+                overlap,
+                (const P2D::circle_overlap_t&, std::vector<uint64_t>*),
+                (const, override));
+    MOCK_METHOD(void,
+                castRaysClosest,
+                (std::span<const P2D::ray_cast_t>, std::span<P2D::cast_hit_t>),
+                (override));
+    MOCK_METHOD(void,
+                overlap,
+                (std::span<const P2D::aabb_overlap_t>, std::span<std::vector<uint64_t>>),
+                (override));
+    MOCK_METHOD(Scoped<P2D::RigidBody>,
+                createRigidBody,
+                (P2D::RigidBody::Type, const Vec2&, float, uint64_t),
+                (override));
+    MOCK_METHOD(std::vector<Scoped<P2D::RigidBody>>,
+                createRigidBodies,
+                (std::span<const P2D::body_def_t>,
+                 std::span<const P2D::box_shape_def_t>,
+                 std::span<const P2D::circle_shape_def_t>),
+                (override));
+};
+
+class Runtime2DExecutorTest: public Test
+{
+protected:
+    Runtime2DExecutorTest()
+    {
+        ON_CALL(world, bodyMoveEvents()).WillByDefault(ReturnRef(move_events));
+        ON_CALL(world, contactEvents()).WillByDefault(ReturnRef(contact_events));
+        ON_CALL(world, createRigidBodies(_, _, _))
+            .WillByDefault([this](auto bodies, auto boxes, auto circles) {
+                body_defs.assign(bodies.begin(), bodies.end());
+                box_defs.assign(boxes.begin(), boxes.end());
+                circle_defs.assign(circles.begin(), circles.end());
+                return takeMockBodies(bodies);
+            });
+    }
+
+    Entity createEntity(std::string_view name)
+    {
+        auto entity = scene.createEntity(name);
+
+        if (auto tail = scene.tailEnity(); tail != entity) {
+            EntityNode{tail}.insert(entity);
+        }
+
+        return entity;
+    }
+
+    static P2D::body_state_t toBodyState(const P2D::pose_t& pose)
+    {
+        return {pose.position, Vec2{std::cos(pose.angle), std::sin(pose.angle)}};
+    }
+
+    Entity createBody(std::string_view name, const P2D::pose_t& pose)
+    {
+        auto mock_body = makeScoped<NiceMock<MockRigidBody>>();
+        ON_CALL(*mock_body, pose()).WillByDefault(Return(pose));
+        ON_CALL(*mock_body, state()).WillByDefault(Return(toBodyState(pose)));
+
+        mock_bodies.emplace_back(pose.position, std::move(mock_body));
+
+        auto entity = createEntity(name);
+        entity.get<TransformComponent>().translation = Vec3{pose.position, 0.0f};
+        entity.add<RigidBody2DComponent>();
+        return entity;
+    }
+
+    std::vector<Scoped<P2D::RigidBody>> takeMockBodies(std::span<const P2D::body_def_t> bodies)
+    {
+        std::vector<Scoped<P2D::RigidBody>> result;
+
+        for (const auto& body : bodies) {
+            auto it = std::find_if(
+                mock_bodies.begin(), mock_bodies.end(), [&body](const auto& mock) {
+                    return mock.second != nullptr && mock.first == body.pose.position;
+                });
+
+            result.push_back(it != mock_bodies.end() ? std::move(it->second)
+                                                     : makeScoped<NiceMock<MockRigidBody>>());
+        }
+
+        return result;
+    }
+
+    static P2D::body_move_event_t moveEvent(const Entity& entity, const P2D::pose_t& pose)
+    {
+        return {pose, userData(entity)};
+    }
+
+    static uint64_t userData(const Entity& entity)
+    {
+        return static_cast<uint64_t>(entity.nativeHandle());
+    }
+
+    static constexpr Runtime2DExecutor::config_t CONFIG{.step_rate = 64.0,
+                                                        .max_steps_per_update = 4};
+    static constexpr double STEP{1.0 / CONFIG.step_rate};
+
+    NiceMock<MockWorld>                 world;
+    Scene                               scene;
+    std::vector<P2D::body_move_event_t> move_events;
+    P2D::contact_events_t               contact_events;
+
+    std::vector<std::pair<Vec2, Scoped<P2D::RigidBody>>> mock_bodies;
+    std::vector<P2D::body_def_t>                         body_defs;
+    std::vector<P2D::box_shape_def_t>                    box_defs;
+    std::vector<P2D::circle_shape_def_t>                 circle_defs;
+};
+
+TEST_F(Runtime2DExecutorTest, StepsWithFixedTimestep)
+{
+    Runtime2DExecutor executor{&scene, &world, CONFIG};
+
+    EXPECT_CALL(world, step(Property(&Timestamp::sec, DoubleEq(STEP)), _)).Times(3);
+    executor.onUpdate(STEP * 3.5);
+    EXPECT_NEAR(executor.interpolationAlpha(), 0.5f, 1e-4f);
+
+    EXPECT_CALL(world, step(_, _)).Times(1);
+    executor.onUpdate(STEP * 0.5);
+    EXPECT_NEAR(executor.interpolationAlpha(), 0.0f, 1e-4f);
+}
+
+TEST_F(Runtime2DExecutorTest, LimitsCatchUpSteps)
+{
+    Runtime2DExecutor executor{&scene, &world, CONFIG};
+
+    EXPECT_CALL(world, step(_, _)).Times(CONFIG.max_steps_per_update);
+    executor.onUpdate(STEP * 10.25);
+    EXPECT_NEAR(executor.interpolationAlpha(), 0.25f, 1e-4f);
+
+    EXPECT_CALL(world, step(_, _)).Times(0);
+    executor.onUpdate(STEP * 0.5);
+}
+
+TEST_F(Runtime2DExecutorTest, InterpolatesBodyPoses)
+{
+    auto entity = createBody("body", {{0.0f, 0.0f}, 0.0f});
+
+    Runtime2DExecutor executor{&scene, &world, CONFIG};
+    move_events = {moveEvent(entity, {{2.0f, 4.0f}, 1.0f})};
+    executor.onUpdate(STEP * 1.5);
+
+    const auto& transform = entity.get<TransformComponent>();
+    EXPECT_NEAR(transform.translation.x, 1.0f, 1e-4f);
+    EXPECT_NEAR(transform.translation.y, 2.0f, 1e-4f);
+    EXPECT_NEAR(transform.rotation.z, 0.5f, 1e-4f);
+
+    // The body stops moving, so the next step settles it on the last pose
+    move_events.clear();
+    executor.onUpdate(STEP);
+
+    EXPECT_NEAR(transform.translation.x, 2.0f, 1e-4f);
+    EXPECT_NEAR(transform.translation.y, 4.0f, 1e-4f);
+    EXPECT_NEAR(transform.rotation.z, 1.0f, 1e-4f);
+}
+
+TEST_F(Runtime2DExecutorTest, WritesBackOnlyMovedBodies)
+{
+    auto moving = createBody("moving", {{0.0f, 0.0f}, 0.0f});
+    auto sleeping = createBody("sleeping", {{5.0f, 5.0f}, 0.0f});
+
+    Runtime2DExecutor executor{&scene, &world, CONFIG};
+    sleeping.get<TransformComponent>().translation = Vec3{7.0f, 7.0f, 0.0f};
+
+    move_events = {moveEvent(moving, {{1.0f, 1.0f}, 0.0f})};
+    executor.onUpdate(STEP * 1.5);
+
+    EXPECT_NEAR(moving.get<TransformComponent>().translation.x, 0.5f, 1e-4f);
+    EXPECT_NEAR(sleeping.get<TransformComponent>().translation.x, 7.0f, 1e-4f);
+}
+
+TEST_F(Runtime2DExecutorTest, CreatesBodiesInWorldSpace)
+{
+    auto parent = createEntity("parent");
+    parent.get<TransformComponent>().translation = Vec3{1.0f, 2.0f, 0.0f};
+    parent.get<TransformComponent>().scale = Vec3{2.0f, 2.0f, 1.0f};
+
+    auto child = scene.createEntity("child");
+    child.get<TransformComponent>().translation = Vec3{1.0f, 0.0f, 0.0f};
+    child.add<RigidBody2DComponent>().fixed_rotation = true;
+    child.add<BoxCollider2DComponent>().size = Vec2{1.0f, 0.5f};
+    EntityNode{parent}.appendChild(child);
+
+    Runtime2DExecutor executor{&scene, &world, CONFIG};
+
+    ASSERT_EQ(body_defs.size(), 1);
+    EXPECT_NEAR(body_defs[0].pose.position.x, 3.0f, 1e-4f);
+    EXPECT_NEAR(body_defs[0].pose.position.y, 2.0f, 1e-4f);
+    EXPECT_TRUE(body_defs[0].fixed_rotation);
+    EXPECT_EQ(body_defs[0].user_data, userData(child));
+
+    ASSERT_EQ(box_defs.size(), 1);
+    EXPECT_EQ(box_defs[0].body, 0);
+    EXPECT_NEAR(box_defs[0].config.size.x, 2.0f, 1e-4f);
+    EXPECT_NEAR(box_defs[0].config.size.y, 1.0f, 1e-4f);
+    EXPECT_TRUE(circle_defs.empty());
+
+    EXPECT_NE(child.get<RigidBody2DComponent>().body, nullptr);
+}
+
+TEST_F(Runtime2DExecutorTest, MapsContactEventsToEntities)
+{
+    auto body = createBody("body", {{0.0f, 0.0f}, 0.0f});
+    auto ground = createBody("ground", {{0.0f, -5.0f}, 0.0f});
+    auto trigger = createBody("trigger", {{0.0f, 5.0f}, 0.0f});
+
+    Runtime2DExecutor executor{&scene, &world, CONFIG};
+    contact_events.begin_events = {{userData(body), userData(ground)}};
+    contact_events.hit_events = {
+        {userData(body), userData(ground), {0.0f, -4.5f}, {0.0f, -1.0f}, 3.0f}};
+    contact_events.sensor_begin_events = {{userData(trigger), userData(body)}};
+
+    // Events of every step run by an update are collected together
+    executor.onUpdate(STEP * 2.0);
+
+    const auto& events = executor.contactEvents();
+    ASSERT_EQ(events.begin_contacts.size(), 2);
+    EXPECT_EQ(events.begin_contacts[0].entity_a, body.nativeHandle());
+    EXPECT_EQ(events.begin_contacts[0].entity_b, ground.nativeHandle());
+    ASSERT_EQ(events.hits.size(), 2);
+    EXPECT_EQ(events.hits[0].normal, Vec2(0.0f, -1.0f));
+    EXPECT_FLOAT_EQ(events.hits[0].approach_speed, 3.0f);
+    ASSERT_EQ(events.sensor_begins.size(), 2);
+    EXPECT_EQ(events.sensor_begins[0].sensor, trigger.nativeHandle());
+    EXPECT_EQ(events.sensor_begins[0].visitor, body.nativeHandle());
+    EXPECT_TRUE(events.end_contacts.empty());
+
+    // An update without steps reports nothing
+    executor.onUpdate(STEP * 0.5);
+    EXPECT_TRUE(executor.contactEvents().begin_contacts.empty());
+}
+
+TEST_F(Runtime2DExecutorTest, RestoresSnapshotIntoExistingBodies)
+{
+    auto entity = createBody("body", {{1.0f, 2.0f}, 0.5f});
+
+    Runtime2DExecutor executor{&scene, &world, CONFIG};
+    auto&             body = static_cast<MockRigidBody&>(*entity.get<RigidBody2DComponent>().body);
+
+    std::vector<uint8_t> snapshot;
+    P2D::body_state_t    saved_state{toBodyState({{1.0f, 2.0f}, 0.5f})};
+    saved_state.linear_velocity = {3.0f, -4.0f};
+    saved_state.angular_velocity = 0.25f;
+    saved_state.is_awake = false;
+    EXPECT_CALL(body, state()).WillOnce(Return(saved_state));
+    executor.saveSnapshot(&snapshot);
+
+    move_events = {moveEvent(entity, {{5.0f, 6.0f}, 0.0f})};
+    executor.onUpdate(STEP);
+
+    P2D::body_state_t restored_state;
+    EXPECT_CALL(body, setState(_)).WillOnce(SaveArg<0>(&restored_state));
+    EXPECT_CALL(body, pose()).WillOnce(Return(P2D::pose_t{{1.0f, 2.0f}, 0.5f}));
+    ASSERT_TRUE(executor.restoreSnapshot(snapshot));
+
+    EXPECT_EQ(restored_state.position, saved_state.position);
+    EXPECT_EQ(restored_state.rotation, saved_state.rotation);
+    EXPECT_EQ(restored_state.linear_velocity, saved_state.linear_velocity);
+    EXPECT_FLOAT_EQ(restored_state.angular_velocity, saved_state.angular_velocity);
+    EXPECT_FALSE(restored_state.is_awake);
+
+    const auto& transform = entity.get<TransformComponent>();
+    EXPECT_NEAR(transform.translation.x, 1.0f, 1e-4f);
+    EXPECT_NEAR(transform.translation.y, 2.0f, 1e-4f);
+    EXPECT_NEAR(transform.rotation.z, 0.5f, 1e-4f);
+}
+
+TEST_F(Runtime2DExecutorTest, SnapshotRoundTripIsBitExact)
+{
+    auto entity = createBody("body", {{1.0f, 2.0f}, 0.0f});
+
+    Runtime2DExecutor executor{&scene, &world, CONFIG};
+    auto&             body = static_cast<MockRigidBody&>(*entity.get<RigidBody2DComponent>().body);
+
+    // Converting through an angle would round an arbitrary cosine and sine pair
+    P2D::body_state_t state{{1.0f, 2.0f}, {0.8f, 0.6f}, {3.0f, -4.0f}, 0.25f, true};
+    ON_CALL(body, state()).WillByDefault(ReturnPointee(&state));
+    ON_CALL(body, setState(_)).WillByDefault(SaveArg<0>(&state));
+
+    std::vector<uint8_t> saved;
+    executor.saveSnapshot(&saved);
+    ASSERT_TRUE(executor.restoreSnapshot(saved));
+
+    std::vector<uint8_t> resaved;
+    executor.saveSnapshot(&resaved);
+    EXPECT_EQ(resaved, saved);
+}
+
+TEST_F(Runtime2DExecutorTest, RejectsMismatchingSnapshot)
+{
+    createBody("body", {{0.0f, 0.0f}, 0.0f});
+
+    Runtime2DExecutor    executor{&scene, &world, CONFIG};
+    std::vector<uint8_t> snapshot;
+    executor.saveSnapshot(&snapshot);
+
+    snapshot.pop_back();
+    EXPECT_FALSE(executor.restoreSnapshot(snapshot));
+}
+
+} // namespace
@@ -46,6 +46,7 @@
 
 #include <fstream>
 #include <string>
+#include <thread>
 
 using namespace GE::Scene;
 using namespace GE::Tests;
@@ -263,4 +264,177 @@ scene:
     ASSERT_FALSE(deserializer.deserialize(scene_filepath));
 }
 
+TEST_F(SceneDeserializerTest, KeepsResourceIDsWithoutAssets)
+{
+    constexpr std::string_view SCENE_FILE = R"(
+scene:
+  name: "TestScene"
+  serialization_version: 1
+  entities:
+    - components:
+        - type: Tag
+          tag: "sprite"
+        - type: Sprite
+          color: [1.0, 0.5, 0.0]
+          resources:
+            texture: {package: "genesis", group: "TEXTURES", name: "square"}
+            mesh: {package: "genesis", group: "MESHES", name: "square"}
+)";
+
+    auto scene_filepath = tmpSceneFilepath();
+    writeToFile(scene_filepath, SCENE_FILE);
+
+    SceneDeserializer headless_deserializer{&scene, nullptr};
+    ASSERT_TRUE(headless_deserializer.deserialize(scene_filepath));
+
+    auto entity = scene.headEntity();
+    ASSERT_TRUE(entity.has<SpriteComponent>());
+
+    ASSERT_TRUE(entity.has<SpriteResourcesComponent>());
+
+    const auto& resources = entity.get<SpriteResourcesComponent>();
+    EXPECT_FALSE(entity.get<SpriteComponent>().isValid());
+    EXPECT_EQ(resources.texture.name(), "square");
+    EXPECT_EQ(resources.mesh.group(), GE::Assets::Group::MESHES);
+}
+
+TEST_F(SceneDeserializerTest, LoadsSpriteResourcesAsSeparateComponent)
+{
+    constexpr std::string_view SCENE_FILE = R"(
+scene:
+  name: "TestScene"
+  serialization_version: 1
+  entities:
+    - components:
+        - type: Tag
+          tag: "sprite"
+        - type: SpriteResources
+          texture: {package: "genesis", group: "TEXTURES", name: "circle"}
+          mesh: {package: "genesis", group: "MESHES", name: "circle"}
+        - type: Sprite
+          color: [1.0, 0.5, 0.0]
+)";
+
+    auto scene_filepath = tmpSceneFilepath();
+    writeToFile(scene_filepath, SCENE_FILE);
+
+    SceneDeserializer headless_deserializer{&scene, nullptr};
+    ASSERT_TRUE(headless_deserializer.deserialize(scene_filepath));
+
+    auto entity = scene.headEntity();
+    ASSERT_TRUE(entity.has<SpriteComponent>());
+    ASSERT_TRUE(entity.has<SpriteResourcesComponent>());
+
+    const auto& resources = entity.get<SpriteResourcesComponent>();
+    EXPECT_EQ(entity.get<SpriteComponent>().color, GE::Vec3(1.0f, 0.5f, 0.0f));
+    EXPECT_EQ(resources.texture.name(), "circle");
+    EXPECT_EQ(resources.mesh.group(), GE::Assets::Group::MESHES);
+}
+
+TEST_F(SceneDeserializerTest, LoadsSceneIncrementally)
+{
+    constexpr std::string_view SCENE_FILE = R"(
+scene:
+  name: "TestScene"
+  serialization_version: 1
+  entities:
+    - components:
+        - type: Tag
+          tag: "parent 1"
+      children:
+        - components:
+            - type: Tag
+              tag: "child 1-1"
+        - components:
+            - type: Tag
+              tag: "child 1-2"
+    - components:
+        - type: Tag
+          tag: "parent 2"
+)";
+
+    constexpr uint32_t ENTITY_COUNT{4};
+
+    auto scene_filepath = tmpSceneFilepath();
+    writeToFile(scene_filepath, SCENE_FILE);
+
+    deserializer.start(scene_filepath);
+
+    auto status = deserializer.update(0.0);
+    while (status == SceneDeserializer::Status::PARSING) {
+        std::this_thread::yield();
+        status = deserializer.update(0.0);
+    }
+
+    // A zero budget still makes progress, one entity per update
+    for (uint32_t i{1}; status == SceneDeserializer::Status::LOADING; i++) {
+        EXPECT_EQ(deserializer.loadedEntityCount(), i);
+        EXPECT_TRUE(scene.headEntity().isNull());
+        status = deserializer.update(0.0);
+    }
+
+    ASSERT_EQ(status, SceneDeserializer::Status::DONE);
+    EXPECT_EQ(deserializer.loadedEntityCount(), ENTITY_COUNT);
+
+    auto parent1 = EntityNode{scene.headEntity()};
+    ASSERT_FALSE(parent1.isNull());
+    EXPECT_THAT(parent1.entity().get<TagComponent>(), isTagComponent("parent 1"));
+    ASSERT_TRUE(parent1.hasChildNode());
+
+    auto child1 = parent1.childNode();
+    EXPECT_THAT(child1.entity().get<TagComponent>(), isTagComponent("child 1-1"));
+    ASSERT_TRUE(child1.hasNextNode());
+
+    auto child2 = child1.nextNode();
+    EXPECT_THAT(child2.entity().get<TagComponent>(), isTagComponent("child 1-2"));
+    EXPECT_EQ(child2.parentNode().entity(), parent1.entity());
+    EXPECT_FALSE(child2.hasNextNode());
+
+    auto parent2 = parent1.nextNode();
+    ASSERT_FALSE(parent2.isNull());
+    EXPECT_THAT(parent2.entity().get<TagComponent>(), isTagComponent("parent 2"));
+    EXPECT_FALSE(parent2.hasNextNode());
+}
+
+TEST_F(SceneDeserializerTest, LoadedTagsAreIndexed)
+{
+    constexpr std::string_view SCENE_FILE = R"(
+scene:
+  name: "TestScene"
+  serialization_version: 1
+  entities:
+    - components:
+        - type: Tag
+          tag: "player"
+      children:
+        - components:
+            - type: Tag
+              tag: "weapon"
+)";
+
+    auto scene_filepath = tmpSceneFilepath();
+    writeToFile(scene_filepath, SCENE_FILE);
+
+    ASSERT_TRUE(deserializer.deserialize(scene_filepath));
+
+    auto player = EntityNode{scene.headEntity()};
+    ASSERT_FALSE(player.isNull());
+    EXPECT_EQ(scene.findEntity("player"), player.entity());
+    EXPECT_EQ(scene.findEntity("weapon"), player.childNode().entity());
+    EXPECT_TRUE(scene.findEntity("Entity").isNull());
+}
+
+TEST_F(SceneDeserializerTest, ReportsFailedIncrementalLoading)
+{
+    deserializer.start(GE::FS::joinPath(tmpDir.path(), "missing.yaml"));
+
+    auto status = deserializer.update(0.0);
+    while (status == SceneDeserializer::Status::PARSING) {
+        std::this_thread::yield();
+        status = deserializer.update(0.0);
+    }
+
+    EXPECT_EQ(status, SceneDeserializer::Status::FAILED);
+}
+
 } // namespace
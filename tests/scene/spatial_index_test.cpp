@@ -0,0 +1,187 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2024, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "genesis/assets/registry.h"
+#include "genesis/scene/components.h"
+#include "genesis/scene/entity_node.h"
+#include "genesis/scene/scene.h"
+#include "genesis/scene/spatial_index.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <random>
+
+using namespace GE;
+using namespace GE::Scene;
+using namespace testing;
+
+namespace {
+
+aabb_t makeBounds(const Vec2& center, const Vec2& half_size)
+{
+    return {Vec3{center - half_size, 0.0f}, Vec3{center + half_size, 0.0f}};
+}
+
+std::vector<Entity::NativeHandle> queryAll(const SpatialIndex& index, const aabb_t& bounds)
+{
+    std::vector<Entity::NativeHandle> entities;
+    index.query(bounds, [&entities](auto entity) { entities.push_back(entity); });
+    return entities;
+}
+
+class SpatialIndexTest: public Test
+{
+protected:
+    SpatialIndex index;
+};
+
+TEST_F(SpatialIndexTest, QueryReturnsOverlappingEntities)
+{
+    index.insert(Entity::NativeHandle{1}, makeBounds({0.0f, 0.0f}, {1.0f, 1.0f}));
+    index.insert(Entity::NativeHandle{2}, makeBounds({5.0f, 5.0f}, {1.0f, 1.0f}));
+    index.insert(Entity::NativeHandle{3}, makeBounds({-5.0f, 0.0f}, {1.0f, 1.0f}));
+
+    EXPECT_THAT(queryAll(index, makeBounds({0.5f, 0.5f}, {0.1f, 0.1f})),
+                ElementsAre(Entity::NativeHandle{1}));
+    EXPECT_THAT(queryAll(index, makeBounds({0.0f, 2.5f}, {6.0f, 3.0f})),
+                UnorderedElementsAre(Entity::NativeHandle{1}, Entity::NativeHandle{2},
+                                     Entity::NativeHandle{3}));
+    EXPECT_THAT(queryAll(index, makeBounds({20.0f, 20.0f}, {1.0f, 1.0f})), IsEmpty());
+}
+
+TEST_F(SpatialIndexTest, MoveAndRemove)
+{
+    index.insert(Entity::NativeHandle{1}, makeBounds({0.0f, 0.0f}, {1.0f, 1.0f}));
+    index.move(Entity::NativeHandle{1}, makeBounds({10.0f, 0.0f}, {1.0f, 1.0f}));
+
+    EXPECT_THAT(queryAll(index, makeBounds({0.0f, 0.0f}, {1.0f, 1.0f})), IsEmpty());
+    EXPECT_THAT(queryAll(index, makeBounds({10.0f, 0.0f}, {0.5f, 0.5f})),
+                ElementsAre(Entity::NativeHandle{1}));
+
+    index.remove(Entity::NativeHandle{1});
+    EXPECT_FALSE(index.contains(Entity::NativeHandle{1}));
+    EXPECT_THAT(queryAll(index, makeBounds({10.0f, 0.0f}, {0.5f, 0.5f})), IsEmpty());
+}
+
+TEST_F(SpatialIndexTest, QueryPointAndRaycast)
+{
+    index.insert(Entity::NativeHandle{1}, makeBounds({0.0f, 0.0f}, {1.0f, 1.0f}));
+    index.insert(Entity::NativeHandle{2}, makeBounds({3.0f, 0.0f}, {1.0f, 1.0f}));
+
+    std::vector<Entity::NativeHandle> entities;
+    index.queryPoint({3.5f, 0.5f}, [&entities](auto entity) { entities.push_back(entity); });
+    EXPECT_THAT(entities, ElementsAre(Entity::NativeHandle{2}));
+
+    std::vector<std::pair<Entity::NativeHandle, float>> hits;
+    index.raycast(Vec3{-5.0f, 0.0f, 0.0f}, Vec3{1.0f, 0.0f, 0.0f},
+                  [&hits](auto entity, float distance) { hits.emplace_back(entity, distance); });
+    EXPECT_THAT(hits, UnorderedElementsAre(Pair(Entity::NativeHandle{1}, FloatEq(4.0f)),
+                                           Pair(Entity::NativeHandle{2}, FloatEq(7.0f))));
+}
+
+TEST_F(SpatialIndexTest, UnboundedEntitiesAreAlwaysVisible)
+{
+    index.insert(Entity::NativeHandle{1}, makeBounds({0.0f, 0.0f}, {0.5f, 0.5f}));
+    index.insert(Entity::NativeHandle{2}, makeBounds({10.0f, 10.0f}, {0.5f, 0.5f}));
+    index.insertUnbounded(Entity::NativeHandle{3});
+
+    std::vector<Entity::NativeHandle> entities;
+    auto frustum = frustum_t::fromViewProjection(Mat4{1.0f});
+    index.queryFrustum(frustum, [&entities](auto entity) { entities.push_back(entity); });
+    EXPECT_THAT(entities, UnorderedElementsAre(Entity::NativeHandle{1}, Entity::NativeHandle{3}));
+    EXPECT_TRUE(index.contains(Entity::NativeHandle{3}));
+
+    index.insert(Entity::NativeHandle{3}, makeBounds({10.0f, 10.0f}, {0.5f, 0.5f}));
+    entities.clear();
+    index.queryFrustum(frustum, [&entities](auto entity) { entities.push_back(entity); });
+    EXPECT_THAT(entities, ElementsAre(Entity::NativeHandle{1}));
+    EXPECT_EQ(index.size(), 3);
+}
+
+TEST_F(SpatialIndexTest, StaysBalancedUnderRandomUpdates)
+{
+    constexpr uint32_t ENTITY_COUNT{1024};
+
+    std::mt19937                          generator{0};
+    std::uniform_real_distribution<float> position{-100.0f, 100.0f};
+
+    for (uint32_t i{0}; i < ENTITY_COUNT; i++) {
+        index.insert(Entity::NativeHandle{i},
+                     makeBounds({position(generator), position(generator)}, {0.5f, 0.5f}));
+    }
+
+    for (uint32_t i{0}; i < ENTITY_COUNT; i += 2) {
+        index.move(Entity::NativeHandle{i},
+                   makeBounds({position(generator), position(generator)}, {0.5f, 0.5f}));
+    }
+
+    EXPECT_EQ(index.size(), ENTITY_COUNT);
+    EXPECT_LE(index.height(), 2 * 11);
+    EXPECT_THAT(queryAll(index, makeBounds({0.0f, 0.0f}, {200.0f, 200.0f})),
+                SizeIs(ENTITY_COUNT));
+}
+
+TEST(SpatialIndexUpdateTest, RefreshesPatchedSubtrees)
+{
+    Assets::Registry assets;
+    GE::Scene::Scene scene;
+
+    auto parent = scene.createEntity("parent");
+    auto child = scene.createEntity("child");
+    EntityNode{parent}.appendChild(child);
+    child.patch<TransformComponent>(
+        [](auto& transform) { transform.translation = {1.0f, 0.0f, 0.0f}; });
+
+    scene.updateSpatialIndex(assets);
+    EXPECT_EQ(Vec3{scene.spatialIndex().worldTransform(child.nativeHandle())[3]},
+              (Vec3{1.0f, 0.0f, 0.0f}));
+
+    parent.patch<TransformComponent>(
+        [](auto& transform) { transform.translation = {0.0f, 2.0f, 0.0f}; });
+    scene.updateSpatialIndex(assets);
+    EXPECT_EQ(Vec3{scene.spatialIndex().worldTransform(child.nativeHandle())[3]},
+              (Vec3{1.0f, 2.0f, 0.0f}));
+
+    // Writes through get() aren't tracked until the component is patched
+    parent.get<TransformComponent>().translation = {0.0f, 0.0f, 0.0f};
+    scene.updateSpatialIndex(assets);
+    EXPECT_EQ(Vec3{scene.spatialIndex().worldTransform(child.nativeHandle())[3]},
+              (Vec3{1.0f, 2.0f, 0.0f}));
+
+    EntityNode{parent}.insert(child);
+    scene.updateSpatialIndex(assets);
+    EXPECT_EQ(Vec3{scene.spatialIndex().worldTransform(child.nativeHandle())[3]},
+              (Vec3{1.0f, 0.0f, 0.0f}));
+}
+
+} // namespace
@@ -0,0 +1,104 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2024, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "genesis/scene/components.h"
+#include "genesis/scene/entity.h"
+#include "genesis/scene/scene.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+using namespace GE::Scene;
+
+namespace {
+
+constexpr uint32_t SPRITE_COUNT{100'000};
+constexpr uint32_t ITERATION_COUNT{10};
+
+// Iterating the sprite storage the way the renderer reads it, the numbers are reported as test
+// properties so layouts can be compared between builds
+class SpriteIterationTest: public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        for (uint32_t i{0}; i < SPRITE_COUNT; ++i) {
+            auto entity = scene.createEntity("sprite");
+            entity.add<TransformComponent>();
+            entity.add<SpriteResourcesComponent>(
+                GE::Assets::ResourceID{"genesis", GE::Assets::Group::TEXTURES, "square"},
+                GE::Assets::ResourceID{"genesis", GE::Assets::Group::MESHES, "square"});
+            entity.add<SpriteComponent>().color = GE::Vec3{1.0f};
+        }
+    }
+
+    Scene scene;
+};
+
+TEST_F(SpriteIterationTest, HotSpriteHoldsOnlyHandlesAndColor)
+{
+    constexpr auto HOT_SIZE =
+        sizeof(GE::Assets::TextureHandle) + sizeof(GE::Assets::MeshHandle) + sizeof(GE::Vec3);
+
+    EXPECT_EQ(sizeof(SpriteComponent), HOT_SIZE);
+    EXPECT_EQ(sizeof(TagComponent), sizeof(GE::StringTable::ID));
+}
+
+TEST_F(SpriteIterationTest, MeasuresIterationBandwidth)
+{
+    float color_sum{0.0f};
+    auto  start = std::chrono::steady_clock::now();
+
+    for (uint32_t i{0}; i < ITERATION_COUNT; ++i) {
+        scene.forEach<SpriteComponent>([&color_sum](const auto& entity) {
+            color_sum += entity.template get<SpriteComponent>().color.r;
+        });
+    }
+
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start);
+    auto bytes = static_cast<double>(sizeof(SpriteComponent)) * SPRITE_COUNT * ITERATION_COUNT;
+
+    RecordProperty("sprite_bytes_per_entity", static_cast<int>(sizeof(SpriteComponent)));
+    RecordProperty("sprite_resources_bytes_per_entity",
+                   static_cast<int>(sizeof(SpriteResourcesComponent)));
+    RecordProperty("tag_bytes_per_entity", static_cast<int>(sizeof(TagComponent)));
+    RecordProperty("sprite_iteration_ns_per_entity",
+                   static_cast<int>(elapsed.count() * 1e9 / (SPRITE_COUNT * ITERATION_COUNT)));
+    RecordProperty("sprite_iteration_mb_per_second",
+                   static_cast<int>(bytes / elapsed.count() / (1024.0 * 1024.0)));
+
+    EXPECT_FLOAT_EQ(color_sum, static_cast<float>(SPRITE_COUNT * ITERATION_COUNT));
+}
+
+} // namespace
@@ -0,0 +1,140 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2024, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "genesis/scene/components.h"
+#include "genesis/scene/scene.h"
+#include "genesis/scene/system_scheduler.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+
+using namespace GE::Scene;
+using namespace testing;
+
+namespace {
+
+constexpr uint32_t WORKER_COUNT{4};
+
+class SystemSchedulerTest: public Test
+{
+protected:
+    void addSystem(std::string name, ComponentAccess access)
+    {
+        scheduler.addSystem(std::move(name), std::move(access), [](const auto&) {});
+    }
+
+    Scene           scene;
+    SystemScheduler scheduler{WORKER_COUNT};
+};
+
+TEST_F(SystemSchedulerTest, ConflictingSystemsRunInOrder)
+{
+    addSystem("movement", ComponentAccess{}.write<TransformComponent>());
+    addSystem("camera", ComponentAccess{}.read<TransformComponent>().write<CameraComponent>());
+    addSystem("sprites", ComponentAccess{}.read<CameraComponent>());
+
+    EXPECT_THAT(scheduler.batches(),
+                ElementsAre(ElementsAre("movement"), ElementsAre("camera"), ElementsAre("sprites")));
+}
+
+TEST_F(SystemSchedulerTest, IndependentSystemsShareBatch)
+{
+    addSystem("movement", ComponentAccess{}.write<TransformComponent>());
+    addSystem("tags", ComponentAccess{}.write<TagComponent>());
+    addSystem("camera", ComponentAccess{}.read<TransformComponent>());
+    addSystem("sprites", ComponentAccess{}.read<TransformComponent>().read<TagComponent>());
+
+    EXPECT_THAT(scheduler.batches(), ElementsAre(UnorderedElementsAre("movement", "tags"),
+                                                 UnorderedElementsAre("camera", "sprites")));
+}
+
+TEST_F(SystemSchedulerTest, SyncPointSplitsBatches)
+{
+    addSystem("movement", ComponentAccess{}.write<TransformComponent>());
+    scheduler.addSyncPoint();
+    addSystem("tags", ComponentAccess{}.write<TagComponent>());
+
+    EXPECT_THAT(scheduler.batches(), ElementsAre(ElementsAre("movement"), ElementsAre("tags")));
+}
+
+TEST_F(SystemSchedulerTest, AppliesCommandsAtSyncPoint)
+{
+    std::atomic<uint32_t> entities_before_sync{0};
+    uint32_t              entities_after_sync{0};
+
+    auto count_entities = [this] {
+        uint32_t count{0};
+        scene.forEach<TagComponent>([&count](const auto&) { count++; });
+        return count;
+    };
+
+    scheduler.addSystem("spawner", ComponentAccess{}, [](const auto& ctx) {
+        ctx.systemCommands().createEntity("spawned");
+    });
+    scheduler.addSystem("reader", ComponentAccess{}.read<TagComponent>(),
+                        [&](const auto&) { entities_before_sync = count_entities(); });
+    scheduler.addSyncPoint();
+    scheduler.addSystem("counter", ComponentAccess{}.read<TagComponent>(),
+                        [&](const auto&) { entities_after_sync = count_entities(); });
+
+    scheduler.run(&scene, 0.0);
+
+    EXPECT_EQ(entities_before_sync.load(), 0);
+    EXPECT_EQ(entities_after_sync, 1);
+}
+
+TEST_F(SystemSchedulerTest, ParallelForEachVisitsEveryEntity)
+{
+    constexpr uint32_t ENTITY_COUNT{1000};
+
+    for (uint32_t i{0}; i < ENTITY_COUNT; i++) {
+        scene.createEntity();
+    }
+
+    scheduler.addSystem("movement", ComponentAccess{}.write<TransformComponent>(),
+                        [](const auto& ctx) {
+                            SystemScheduler::parallelForEach<TransformComponent>(
+                                ctx, 16, [](Entity& entity, uint32_t) {
+                                    entity.get<TransformComponent>().translation.x += 1.0f;
+                                });
+                        });
+
+    scheduler.run(&scene, 0.0);
+
+    scene.forEach<TransformComponent>([](const auto& entity) {
+        EXPECT_FLOAT_EQ(entity.template get<TransformComponent>().translation.x, 1.0f);
+    });
+}
+
+} // namespace